@@ -1,97 +1,255 @@
+#include <burst/container/compressed_k_ary_search_set.hpp>
 #include <burst/container/k_ary_search_set.hpp>
-#include <io.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
 
 #include <boost/container/flat_set.hpp>
 #include <boost/program_options.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <limits>
+#include <random>
 #include <set>
+#include <stdexcept>
+#include <string>
 #include <unordered_set>
 #include <vector>
 
-template <typename Container>
-struct default_constructor
+using integer_type = std::int64_t;
+
+//!     Упорядоченный массив, разложенный в порядке обхода двоичного дерева в ширину.
+/*!
+        Раскладка Эйтцингера: потомки элемента с индексом `i` лежат по индексам `2i` и `2i + 1`.
+    Нулевой элемент не используется.
+ */
+class eytzinger_set
 {
-    default_constructor (const std::string & name):
-        name(name)
+public:
+    template <typename Iterator>
+    eytzinger_set (Iterator first, Iterator last):
+        m_values(static_cast<std::size_t>(std::distance(first, last)) + 1)
+    {
+        fill(first, 1);
+    }
+
+    bool contains (integer_type value) const
     {
+        const auto size = m_values.size();
+
+        std::size_t index = 1;
+        while (index < size)
+        {
+            index = 2 * index + static_cast<std::size_t>(m_values[index] < value);
+        }
+
+        // Подъём до узла, в котором последний раз был совершён переход влево.
+        while (index % 2 == 1)
+        {
+            index /= 2;
+        }
+        index /= 2;
+
+        return index != 0 && m_values[index] == value;
     }
 
+private:
     template <typename Iterator>
-    Container operator () (Iterator first, Iterator last) const
+    Iterator fill (Iterator source, std::size_t index)
     {
-        std::cout << name << std::endl;
-        return Container(first, last);
+        if (index < m_values.size())
+        {
+            source = fill(source, 2 * index);
+            m_values[index] = *source++;
+            source = fill(source, 2 * index + 1);
+        }
+
+        return source;
     }
 
-    std::string name;
+private:
+    std::vector<integer_type> m_values;
+};
+
+struct measurement
+{
+    double nanoseconds_per_lookup;
+    std::size_t hits;
 };
 
-template <typename Value>
-struct k_ary_constructor
+//!     Время одной серии поисков.
+/*!
+        Серия запускается `repeats` раз, и берётся наименьшее время, чтобы отсечь случайные
+    задержки. Количество найденных элементов возвращается, чтобы компилятор не выбросил поиск и
+    чтобы проверить правильность структуры.
+ */
+template <typename Contains>
+measurement measure (const std::vector<integer_type> & probes, std::size_t repeats, Contains contains)
 {
-    k_ary_constructor (std::size_t arity):
-        arity(arity)
+    using namespace std::chrono;
+
+    auto best = duration<double, std::nano>(std::numeric_limits<double>::max());
+    std::size_t hits = 0;
+    for (std::size_t repeat = 0; repeat < repeats; ++repeat)
     {
+        const auto start_time = steady_clock::now();
+
+        hits = 0;
+        for (auto probe: probes)
+        {
+            hits += contains(probe);
+        }
+
+        best = std::min<duration<double, std::nano>>(best, steady_clock::now() - start_time);
     }
 
-    template <typename Iterator>
-    burst::k_ary_search_set<Value> operator () (Iterator first, Iterator last) const
+    return measurement{best.count() / static_cast<double>(probes.size()), hits};
+}
+
+struct experiment
+{
+    std::size_t size;
+    double hit_ratio;
+    std::size_t expected_hits;
+};
+
+template <typename Contains>
+void report
+    (
+        const std::string & structure,
+        std::size_t arity,
+        const experiment & e,
+        const std::vector<integer_type> & probes,
+        std::size_t repeats,
+        Contains contains
+    )
+{
+    const auto result = measure(probes, repeats, contains);
+    if (result.hits != e.expected_hits)
     {
-        std::cout << "k_ary_set(" << arity << ")" << std::endl;
-        return burst::k_ary_search_set<Value>(first, last, arity);
+        throw std::runtime_error("Структура " + structure + " нашла не те элементы.");
     }
 
-    std::size_t arity;
-};
+    std::cout
+        << structure << ','
+        << arity << ','
+        << e.size << ','
+        << e.size * sizeof(integer_type) << ','
+        << e.hit_ratio << ','
+        << probes.size() << ','
+        << result.nanoseconds_per_lookup << ','
+        << 1e9 / result.nanoseconds_per_lookup << std::endl;
+}
 
-template <typename Container, typename SetConstructor>
-void test_one (const Container & numbers, std::size_t attempt_count, const SetConstructor & constructor)
+//!     Упорядоченный набор различных чётных чисел.
+/*!
+        Нечётные числа гарантированно отсутствуют в наборе, поэтому из них получаются промахи.
+ */
+std::vector<integer_type> generate_values (std::size_t size, std::mt19937_64 & engine)
 {
-    clock_t creation_time = clock();
-    auto set = constructor(numbers.begin(), numbers.end());
-    creation_time = clock() - creation_time;
+    std::uniform_int_distribution<integer_type> gap(1, 8);
 
-    clock_t search_time = 0;
-    for (std::size_t attempt = 0; attempt < attempt_count; ++attempt)
+    std::vector<integer_type> values(size);
+    auto value = integer_type{0};
+    for (auto & v: values)
     {
-        const auto & element = numbers[static_cast<std::size_t>(random()) % numbers.size()];
+        value += 2 * gap(engine);
+        v = value;
+    }
 
-        clock_t attempt_time = clock();
-        auto search_result = set.find(element);
-        attempt_time = clock() - attempt_time;
+    return values;
+}
 
-        if (search_result == set.end() || *search_result != element)
-        {
-            throw std::runtime_error("Нашлись не все искомые элементы.");
-        }
+std::vector<integer_type>
+    generate_probes
+    (
+        const std::vector<integer_type> & values,
+        std::size_t lookups,
+        double hit_ratio,
+        std::mt19937_64 & engine,
+        std::size_t & hits
+    )
+{
+    std::uniform_int_distribution<std::size_t> position(0, values.size() - 1);
+    std::bernoulli_distribution hit(hit_ratio);
 
-        search_time += attempt_time;
+    hits = 0;
+    std::vector<integer_type> probes(lookups);
+    for (auto & probe: probes)
+    {
+        const auto is_hit = hit(engine);
+        probe = values[position(engine)] + (is_hit ? 0 : 1);
+        hits += is_hit;
     }
 
-    std::cout << "\tВремя создания: " << static_cast<double>(creation_time) / CLOCKS_PER_SEC << std::endl;
-    std::cout << "\tСреднее время поиска: " << static_cast<double>(search_time) / static_cast<double>(attempt_count) / CLOCKS_PER_SEC << std::endl;
-    std::cout << std::endl;
+    return probes;
 }
 
-template <typename Container>
-void test (const Container & arities, std::size_t attempts)
+void
+    test
+    (
+        const std::vector<std::size_t> & arities,
+        const std::vector<double> & hit_ratios,
+        std::size_t min_bytes,
+        std::size_t max_bytes,
+        std::size_t lookups,
+        std::size_t repeats
+    )
 {
-    using integer_type = std::int64_t;
-    std::vector<integer_type> numbers;
-    read(std::cin, numbers);
-    std::sort(numbers.begin(), numbers.end());
-    numbers.erase(std::unique(numbers.begin(), numbers.end()), numbers.end());
+    std::mt19937_64 engine(2017);
 
-    for (auto arity: arities)
+    std::cout << "structure,arity,size,bytes,hit_ratio,lookups,ns_per_lookup,lookups_per_second" << std::endl;
+    for (auto bytes = min_bytes; bytes <= max_bytes; bytes *= 2)
     {
-        test_one(numbers, attempts, k_ary_constructor<integer_type>(arity));
-    }
+        const auto size = std::max<std::size_t>(bytes / sizeof(integer_type), 1);
+        const auto values = generate_values(size, engine);
 
-    test_one(numbers, attempts, default_constructor<std::set<integer_type>>("set"));
-    test_one(numbers, attempts, default_constructor<boost::container::flat_set<integer_type>>("flat_set"));
-    test_one(numbers, attempts, default_constructor<std::unordered_set<integer_type>>("hash_set"));
+        std::vector<burst::k_ary_search_set<integer_type>> k_ary_sets;
+        std::vector<burst::compressed_k_ary_search_set<integer_type>> compressed_sets;
+        for (auto arity: arities)
+        {
+            k_ary_sets.emplace_back(burst::container::unique_ordered_tag, values.begin(), values.end(), arity);
+            compressed_sets.emplace_back(k_ary_sets.back());
+        }
+        const auto eytzinger = eytzinger_set(values.begin(), values.end());
+        const auto tree_set = std::set<integer_type>(values.begin(), values.end());
+        const auto flat_set = boost::container::flat_set<integer_type>
+            (boost::container::ordered_unique_range, values.begin(), values.end());
+        const auto hash_set = std::unordered_set<integer_type>(values.begin(), values.end());
+
+        for (auto hit_ratio: hit_ratios)
+        {
+            auto e = experiment{size, hit_ratio, 0};
+            const auto probes = generate_probes(values, lookups, hit_ratio, engine, e.expected_hits);
+
+            for (const auto & set: k_ary_sets)
+            {
+                report("k_ary_search_set", set.arity(), e, probes, repeats,
+                    [& set] (auto x) {return set.find(x) != set.end();});
+            }
+            for (const auto & set: compressed_sets)
+            {
+                report("compressed_k_ary_search_set", set.arity(), e, probes, repeats,
+                    [& set] (auto x) {return set.contains(x);});
+            }
+            report("lower_bound", 2, e, probes, repeats,
+                [& values] (auto x)
+                {
+                    auto position = std::lower_bound(values.begin(), values.end(), x);
+                    return position != values.end() && *position == x;
+                });
+            report("eytzinger", 2, e, probes, repeats,
+                [& eytzinger] (auto x) {return eytzinger.contains(x);});
+            report("set", 2, e, probes, repeats,
+                [& tree_set] (auto x) {return tree_set.find(x) != tree_set.end();});
+            report("flat_set", 2, e, probes, repeats,
+                [& flat_set] (auto x) {return flat_set.find(x) != flat_set.end();});
+            report("hash_set", 0, e, probes, repeats,
+                [& hash_set] (auto x) {return hash_set.find(x) != hash_set.end();});
+        }
+    }
 }
 
 int main (int argc, const char * argv[])
@@ -101,8 +259,17 @@ int main (int argc, const char * argv[])
     bpo::options_description description("Опции");
     description.add_options()
         ("help,h", "Подсказка")
-        ("arity", bpo::value<std::vector<std::size_t>>()->multitoken(), "Набор кратностей для испытаний")
-        ("attempts", bpo::value<std::size_t>()->default_value(1000));
+        ("arity", bpo::value<std::vector<std::size_t>>()->multitoken()
+            ->default_value(std::vector<std::size_t>{3, 5, 9, 17, 33, 65}, "3 5 9 17 33 65"),
+            "Набор кратностей для испытаний")
+        ("hit-ratio", bpo::value<std::vector<double>>()->multitoken()
+            ->default_value(std::vector<double>{1, 0.5, 0}, "1 0.5 0"),
+            "Набор долей успешных поисков")
+        ("l1", bpo::value<std::size_t>()->default_value(32), "Размер кэша L1 в КиБ — наименьший размер набора")
+        ("llc", bpo::value<std::size_t>()->default_value(8192), "Размер кэша последнего уровня в КиБ")
+        ("llc-factor", bpo::value<std::size_t>()->default_value(8), "Наибольший размер набора в размерах кэша последнего уровня")
+        ("lookups", bpo::value<std::size_t>()->default_value(1 << 20), "Количество поисков в серии")
+        ("repeats", bpo::value<std::size_t>()->default_value(5), "Количество повторений каждой серии");
 
     try
     {
@@ -116,10 +283,14 @@ int main (int argc, const char * argv[])
         }
         else
         {
-            std::vector<std::size_t> arities = vm["arity"].as<std::vector<std::size_t>>();
-            std::size_t attempts = vm["attempts"].as<std::size_t>();
+            const auto arities = vm["arity"].as<std::vector<std::size_t>>();
+            const auto hit_ratios = vm["hit-ratio"].as<std::vector<double>>();
+            const auto min_bytes = vm["l1"].as<std::size_t>() * 1024;
+            const auto max_bytes = vm["llc"].as<std::size_t>() * 1024 * vm["llc-factor"].as<std::size_t>();
+            const auto lookups = vm["lookups"].as<std::size_t>();
+            const auto repeats = vm["repeats"].as<std::size_t>();
 
-            test(arities, attempts);
+            test(arities, hit_ratios, min_bytes, max_bytes, lookups, repeats);
         }
     }
     catch (bpo::error & e)
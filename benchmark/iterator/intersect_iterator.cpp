@@ -1,15 +1,22 @@
+#include <burst/algorithm/intersect_count.hpp>
+#include <burst/container/compressed_posting_list.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+#include <burst/iterator/prefetch_policy.hpp>
 #include <burst/range/intersect.hpp>
 #include <io.hpp>
 
 #include <boost/range/algorithm/for_each.hpp>
 #include <boost/range/iterator_range.hpp>
 
+#include <cstdint>
 #include <iostream>
 #include <numeric>
+#include <random>
+#include <string>
 #include <vector>
 
-template <typename Container>
-void test_on_the_fly_intersect (const Container & values)
+template <typename Container, typename... PrefetchPolicy>
+void test_on_the_fly_intersect (const Container & values, const std::string & name, PrefetchPolicy... policy)
 {
     using nested_container_type = typename Container::value_type;
 
@@ -20,12 +27,65 @@ void test_on_the_fly_intersect (const Container & values)
             ranges.push_back(boost::make_iterator_range(values));
         });
 
+    clock_t intersect_time = clock();
+    auto intersected_range = burst::intersect(policy..., ranges);
+    auto distance = static_cast<std::size_t>(std::distance(intersected_range.begin(), intersected_range.end()));
+    intersect_time = clock() - intersect_time;
+
+    std::cout << name << ": " << distance << std::endl;
+    std::cout << "\t" << static_cast<double>(intersect_time) / CLOCKS_PER_SEC << std::endl;
+    std::cout << std::endl;
+}
+
+template <typename Container>
+void test_compressed_intersect (const Container & values)
+{
+    using integer_type = typename Container::value_type::value_type;
+
+    std::vector<burst::compressed_posting_list<integer_type>> lists;
+    std::size_t plain_bytes = 0;
+    std::size_t compressed_bytes = 0;
+    for (const auto & row: values)
+    {
+        lists.emplace_back(burst::container::unique_ordered_tag, row.begin(), row.end());
+        plain_bytes += row.size() * sizeof(integer_type);
+        compressed_bytes += lists.back().memory_usage();
+    }
+
+    std::vector<boost::iterator_range<typename burst::compressed_posting_list<integer_type>::const_iterator>> ranges;
+    for (const auto & list: lists)
+    {
+        ranges.push_back(boost::make_iterator_range(list));
+    }
+
     clock_t intersect_time = clock();
     auto intersected_range = burst::intersect(ranges);
     auto distance = static_cast<std::size_t>(std::distance(intersected_range.begin(), intersected_range.end()));
     intersect_time = clock() - intersect_time;
 
-    std::cout << "Пересечение на лету: " << distance << std::endl;
+    std::cout << "Пересечение сжатых списков: " << distance << std::endl;
+    std::cout << "\t" << static_cast<double>(intersect_time) / CLOCKS_PER_SEC << std::endl;
+    std::cout << "\tпамять: " << compressed_bytes << " байт вместо " << plain_bytes << std::endl;
+    std::cout << std::endl;
+}
+
+template <typename Container>
+void test_intersect_count (const Container & values)
+{
+    using nested_container_type = typename Container::value_type;
+
+    std::vector<boost::iterator_range<typename nested_container_type::const_iterator>> ranges;
+    boost::for_each(values,
+        [& ranges] (const nested_container_type & values)
+        {
+            ranges.push_back(boost::make_iterator_range(values));
+        });
+
+    clock_t intersect_time = clock();
+    auto count = burst::intersect_count(ranges);
+    intersect_time = clock() - intersect_time;
+
+    std::cout << "Размер пересечения: " << count << std::endl;
     std::cout << "\t" << static_cast<double>(intersect_time) / CLOCKS_PER_SEC << std::endl;
     std::cout << std::endl;
 }
@@ -50,11 +110,72 @@ void test_std_intersect (const Container & values)
     std::cout << std::endl;
 }
 
+//!     Пересечение двух диапазонов одинаковой плотности, половина элементов которых общие.
+/*!
+        Каждое число из [0, 3 * length) с равной вероятностью попадает либо в оба диапазона, либо
+    только в первый, либо только во второй. Поэтому рядом с каждым элементом пересечения почти
+    всегда есть несовпадающие элементы, и пропускать целые блоки почти никогда не удаётся.
+        Пересечение с отношением порядка, заданным лямбдой, не может идти поблочно и служит
+    точкой отсчёта.
+ */
+void test_dense_overlap (std::size_t length)
+{
+    std::mt19937 engine(1);
+    std::uniform_int_distribution<int> owner(0, 2);
+
+    std::vector<std::vector<std::int64_t>> values(2);
+    for (std::int64_t value = 0; value < static_cast<std::int64_t>(3 * length); ++value)
+    {
+        const auto which = owner(engine);
+        if (which != 1)
+        {
+            values[0].push_back(value);
+        }
+        if (which != 0)
+        {
+            values[1].push_back(value);
+        }
+    }
+
+    std::vector<boost::iterator_range<std::vector<std::int64_t>::const_iterator>> ranges;
+    for (const auto & row: values)
+    {
+        ranges.push_back(boost::make_iterator_range(row));
+    }
+    auto plain_ranges = ranges;
+
+    clock_t block_time = clock();
+    const auto intersected_range = burst::intersect(ranges);
+    const auto block_distance = std::distance(intersected_range.begin(), intersected_range.end());
+    block_time = clock() - block_time;
+
+    clock_t plain_time = clock();
+    const auto plain_intersected_range =
+        burst::intersect(plain_ranges, [] (auto x, auto y) {return x < y;});
+    const auto plain_distance = std::distance(plain_intersected_range.begin(), plain_intersected_range.end());
+    plain_time = clock() - plain_time;
+
+    std::cout << "Два диапазона с перекрытием 50%: " << block_distance << std::endl;
+    std::cout << "\t" << static_cast<double>(block_time) / CLOCKS_PER_SEC << std::endl;
+    std::cout << "То же без поблочного пропуска: " << plain_distance << std::endl;
+    std::cout << "\t" << static_cast<double>(plain_time) / CLOCKS_PER_SEC << std::endl;
+    std::cout << std::endl;
+}
+
 int main ()
 {
     std::vector<std::vector<std::int64_t>> values;
     read_many(std::cin, values);
 
     test_std_intersect(values);
-    test_on_the_fly_intersect(values);
+    test_on_the_fly_intersect(values, "Пересечение на лету");
+    const std::size_t distances[] = {2, 4, 8, 16, 32, 64};
+    for (auto distance: distances)
+    {
+        test_on_the_fly_intersect(values, "Пересечение на лету с упреждением на " + std::to_string(distance),
+            burst::iterator::prefetch_t{distance});
+    }
+    test_compressed_intersect(values);
+    test_intersect_count(values);
+    test_dense_overlap(2000000);
 }
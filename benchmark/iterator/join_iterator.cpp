@@ -0,0 +1,152 @@
+#include <burst/algorithm/segmented_accumulate.hpp>
+#include <burst/iterator/join_policy.hpp>
+#include <burst/range/join.hpp>
+#include <io.hpp>
+
+#include <boost/program_options.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using chunk_range_type = boost::iterator_range<std::vector<std::int64_t>::iterator>;
+
+std::vector<chunk_range_type> cut_into_chunks (std::vector<std::int64_t> & values, std::size_t max_chunk_size)
+{
+    std::mt19937 engine(1);
+    std::uniform_int_distribution<std::size_t> chunk_size(0, max_chunk_size);
+
+    std::vector<chunk_range_type> chunks;
+    auto chunk_begin = values.begin();
+    while (chunk_begin != values.end())
+    {
+        const auto size = std::min(chunk_size(engine), static_cast<std::size_t>(values.end() - chunk_begin));
+        const auto chunk_end = chunk_begin + static_cast<std::ptrdiff_t>(size);
+        chunks.emplace_back(chunk_begin, chunk_end);
+        chunk_begin = chunk_end;
+    }
+
+    return chunks;
+}
+
+template <typename RandomAccessRange>
+void test_lower_bound (const RandomAccessRange & range, std::size_t attempts, const std::string & name)
+{
+    std::mt19937 engine(2);
+    std::uniform_int_distribution<std::int64_t> goals(range.front(), range.back());
+
+    std::int64_t checksum = 0;
+    clock_t time = clock();
+    for (std::size_t attempt = 0; attempt < attempts; ++attempt)
+    {
+        const auto position = std::lower_bound(range.begin(), range.end(), goals(engine));
+        checksum += position != range.end() ? *position : 0;
+    }
+    time = clock() - time;
+
+    std::cout << name << ", std::lower_bound: " << checksum << std::endl;
+    std::cout << "\t" << static_cast<double>(time) / CLOCKS_PER_SEC << std::endl;
+}
+
+template <typename Range, typename Accumulate>
+void test_accumulate (const Range & range, std::size_t passes, Accumulate accumulate, const std::string & name)
+{
+    std::int64_t checksum = 0;
+    clock_t time = clock();
+    for (std::size_t pass = 0; pass < passes; ++pass)
+    {
+        checksum += accumulate(range.begin(), range.end(), std::int64_t{0});
+    }
+    time = clock() - time;
+
+    std::cout << name << ": " << checksum << std::endl;
+    std::cout << "\t" << static_cast<double>(time) / CLOCKS_PER_SEC << std::endl;
+}
+
+template <typename RandomAccessRange>
+void test_nth_element (std::vector<std::int64_t> & values, RandomAccessRange && range, const std::string & name)
+{
+    std::mt19937 engine(3);
+    std::shuffle(values.begin(), values.end(), engine);
+
+    clock_t time = clock();
+    const auto middle = range.begin() + (range.end() - range.begin()) / 2;
+    std::nth_element(range.begin(), middle, range.end());
+    time = clock() - time;
+
+    std::cout << name << ", std::nth_element: " << *middle << std::endl;
+    std::cout << "\t" << static_cast<double>(time) / CLOCKS_PER_SEC << std::endl;
+
+    std::sort(values.begin(), values.end());
+}
+
+int main (int argc, const char * argv[])
+{
+    namespace bpo = boost::program_options;
+
+    bpo::options_description description("Опции");
+    description.add_options()
+        ("help,h", "Подсказка")
+        ("chunk", bpo::value<std::size_t>()->default_value(16), "Наибольший размер склеиваемого куска")
+        ("attempts", bpo::value<std::size_t>()->default_value(100000), "Количество поисков")
+        ("passes", bpo::value<std::size_t>()->default_value(100), "Количество проходов при суммировании");
+
+    try
+    {
+        bpo::variables_map vm;
+        bpo::store(bpo::parse_command_line(argc, argv, description), vm);
+        bpo::notify(vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << description << std::endl;
+        }
+        else
+        {
+            std::vector<std::vector<std::int64_t>> input;
+            read_many(std::cin, input);
+
+            std::vector<std::int64_t> values;
+            for (const auto & row: input)
+            {
+                values.insert(values.end(), row.begin(), row.end());
+            }
+            std::sort(values.begin(), values.end());
+
+            const auto chunks = cut_into_chunks(values, vm["chunk"].as<std::size_t>());
+            std::cout << "Элементов: " << values.size() << ", кусков: " << chunks.size() << std::endl;
+            std::cout << std::endl;
+
+            const auto attempts = vm["attempts"].as<std::size_t>();
+            test_lower_bound(boost::make_iterator_range(values), attempts, "Сплошной массив");
+            test_lower_bound(burst::join(chunks), attempts, "Склейка");
+            test_lower_bound(burst::join(burst::iterator::indexed_join, chunks), attempts, "Склейка с индексом");
+            std::cout << std::endl;
+
+            const auto std_accumulate =
+                [] (auto first, auto last, auto init) {return std::accumulate(first, last, init);};
+            const auto segmented_accumulate =
+                [] (auto first, auto last, auto init) {return burst::segmented_accumulate(first, last, init);};
+            const auto passes = vm["passes"].as<std::size_t>();
+            test_accumulate(values, passes, std_accumulate, "Сплошной массив, std::accumulate");
+            test_accumulate(burst::join(chunks), passes, std_accumulate, "Склейка, std::accumulate");
+            test_accumulate(burst::join(chunks), passes, segmented_accumulate, "Склейка, burst::segmented_accumulate");
+            std::cout << std::endl;
+
+            test_nth_element(values, boost::make_iterator_range(values), "Сплошной массив");
+            test_nth_element(values, burst::join(chunks), "Склейка");
+            test_nth_element(values, burst::join(burst::iterator::indexed_join, chunks), "Склейка с индексом");
+        }
+    }
+    catch (bpo::error & e)
+    {
+        std::cout << e.what() << std::endl;
+        std::cout << description << std::endl;
+    }
+}
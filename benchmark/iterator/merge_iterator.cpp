@@ -1,17 +1,27 @@
+#include <burst/algorithm/merge_into.hpp>
+#include <burst/execution/parallel_policy.hpp>
 #include <burst/iterator/merge_iterator.hpp>
+#include <burst/iterator/merge_policy.hpp>
+#include <burst/iterator/prefetch_policy.hpp>
 #include <burst/range/merge.hpp>
 #include <io.hpp>
 
 #include <boost/assert.hpp>
 #include <boost/range/algorithm/for_each.hpp>
+#include <boost/range/numeric.hpp>
 #include <boost/range/iterator_range.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <iterator>
+#include <string>
+#include <thread>
 #include <numeric>
 #include <vector>
 
-template <typename Container>
-void test_on_the_fly_merge (const Container & values)
+template <typename Container, typename... Policy>
+void test_on_the_fly_merge (const Container & values, const std::string & name, Policy... policy)
 {
     using nested_container_type = typename Container::value_type;
 
@@ -23,7 +33,7 @@ void test_on_the_fly_merge (const Container & values)
         });
 
     clock_t merge_time = clock();
-    auto merged_range = burst::merge(boost::make_iterator_range(ranges));
+    auto merged_range = burst::merge(policy..., boost::make_iterator_range(ranges));
     auto distance = static_cast<std::size_t>(std::distance(merged_range.begin(), merged_range.end()));
     merge_time = clock() - merge_time;
 
@@ -37,11 +47,37 @@ void test_on_the_fly_merge (const Container & values)
                 })
     );
 
-    std::cout << "Слияние на лету:" << std::endl;
+    std::cout << name << ":" << std::endl;
     std::cout << "\t" << static_cast<double>(merge_time) / CLOCKS_PER_SEC << std::endl;
     std::cout << std::endl;
 }
 
+template <typename Container, typename... ParallelPolicy>
+void test_merge_into (const Container & values, const std::string & name, ParallelPolicy... policy)
+{
+    using nested_container_type = typename Container::value_type;
+
+    std::vector<boost::iterator_range<typename nested_container_type::const_iterator>> ranges;
+    boost::for_each(values,
+        [& ranges] (const nested_container_type & values)
+        {
+            ranges.push_back(boost::make_iterator_range(values));
+        });
+
+    nested_container_type merged(boost::accumulate(ranges, std::size_t{0},
+        [] (auto size, const auto & range) {return size + range.size();}));
+    // Время замеряется по настенным часам, поскольку clock() суммирует время всех потоков.
+    const auto start_time = std::chrono::steady_clock::now();
+    burst::merge_into(policy..., ranges, merged.begin());
+    const auto merge_time = std::chrono::steady_clock::now() - start_time;
+
+    BOOST_VERIFY(std::is_sorted(merged.begin(), merged.end()));
+
+    std::cout << name << ":" << std::endl;
+    std::cout << "\t" << std::chrono::duration_cast<std::chrono::duration<double>>(merge_time).count() << std::endl;
+    std::cout << std::endl;
+}
+
 template <typename Container>
 void test_merge_by_sorting (const Container & values)
 {
@@ -89,5 +125,17 @@ int main ()
 
     test_merge_by_sorting(values);
     test_std_merge(values);
-    test_on_the_fly_merge(values);
+    test_on_the_fly_merge(values, "Слияние на лету");
+    test_on_the_fly_merge(values, "Слияние на лету деревом проигравших", burst::iterator::loser_tree_merge);
+    const std::size_t distances[] = {2, 4, 8, 16, 32, 64};
+    for (auto distance: distances)
+    {
+        const auto suffix = " с упреждением на " + std::to_string(distance);
+        test_on_the_fly_merge(values, "Слияние на лету" + suffix, burst::iterator::prefetch_t{distance});
+        test_on_the_fly_merge(values, "Слияние на лету деревом проигравших" + suffix,
+            burst::iterator::loser_tree_merge, burst::iterator::prefetch_t{distance});
+    }
+    test_merge_into(values, "merge_into");
+    const auto thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+    test_merge_into(values, "merge_into(par(" + std::to_string(thread_count) + "))", burst::par(thread_count));
 }
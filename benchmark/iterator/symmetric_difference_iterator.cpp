@@ -0,0 +1,61 @@
+#include <burst/range/symmetric_difference.hpp>
+#include <io.hpp>
+
+#include <boost/range/algorithm/for_each.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+template <typename Container>
+void test_on_the_fly_symmetric_difference (const Container & values)
+{
+    using nested_container_type = typename Container::value_type;
+
+    std::vector<boost::iterator_range<typename nested_container_type::const_iterator>> ranges;
+    boost::for_each(values,
+        [& ranges] (const nested_container_type & values)
+        {
+            ranges.push_back(boost::make_iterator_range(values));
+        });
+
+    clock_t difference_time = clock();
+    auto difference = burst::symmetric_difference(ranges);
+    auto distance = static_cast<std::size_t>(std::distance(difference.begin(), difference.end()));
+    difference_time = clock() - difference_time;
+
+    std::cout << "Симметрическая разность на лету: " << distance << std::endl;
+    std::cout << "\t" << static_cast<double>(difference_time) / CLOCKS_PER_SEC << std::endl;
+    std::cout << std::endl;
+}
+
+template <typename Container>
+void test_std_symmetric_difference (const Container & values)
+{
+    typename Container::value_type difference;
+
+    clock_t difference_time = clock();
+    for (const auto & row: values)
+    {
+        typename Container::value_type result;
+        result.reserve(difference.size() + row.size());
+        std::set_symmetric_difference(difference.begin(), difference.end(), row.begin(), row.end(), std::back_inserter(result));
+        std::swap(result, difference);
+    }
+    difference_time = clock() - difference_time;
+
+    std::cout << "std::set_symmetric_difference: " << difference.size() << std::endl;
+    std::cout << "\t" << static_cast<double>(difference_time) / CLOCKS_PER_SEC << std::endl;
+    std::cout << std::endl;
+}
+
+int main ()
+{
+    std::vector<std::vector<std::int64_t>> values;
+    read_many(std::cin, values);
+
+    test_std_symmetric_difference(values);
+    test_on_the_fly_symmetric_difference(values);
+}
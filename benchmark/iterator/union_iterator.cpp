@@ -0,0 +1,61 @@
+#include <burst/range/unite.hpp>
+#include <io.hpp>
+
+#include <boost/range/algorithm/for_each.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+template <typename Container>
+void test_on_the_fly_unite (const Container & values)
+{
+    using nested_container_type = typename Container::value_type;
+
+    std::vector<boost::iterator_range<typename nested_container_type::const_iterator>> ranges;
+    boost::for_each(values,
+        [& ranges] (const nested_container_type & values)
+        {
+            ranges.push_back(boost::make_iterator_range(values));
+        });
+
+    clock_t unite_time = clock();
+    auto united_range = burst::unite(ranges);
+    auto distance = static_cast<std::size_t>(std::distance(united_range.begin(), united_range.end()));
+    unite_time = clock() - unite_time;
+
+    std::cout << "Объединение на лету: " << distance << std::endl;
+    std::cout << "\t" << static_cast<double>(unite_time) / CLOCKS_PER_SEC << std::endl;
+    std::cout << std::endl;
+}
+
+template <typename Container>
+void test_std_unite (const Container & values)
+{
+    typename Container::value_type united;
+
+    clock_t unite_time = clock();
+    for (const auto & row: values)
+    {
+        typename Container::value_type result;
+        result.reserve(united.size() + row.size());
+        std::set_union(united.begin(), united.end(), row.begin(), row.end(), std::back_inserter(result));
+        std::swap(result, united);
+    }
+    unite_time = clock() - unite_time;
+
+    std::cout << "std::set_union: " << united.size() << std::endl;
+    std::cout << "\t" << static_cast<double>(unite_time) / CLOCKS_PER_SEC << std::endl;
+    std::cout << std::endl;
+}
+
+int main ()
+{
+    std::vector<std::vector<std::int64_t>> values;
+    read_many(std::cin, values);
+
+    test_std_unite(values);
+    test_on_the_fly_unite(values);
+}
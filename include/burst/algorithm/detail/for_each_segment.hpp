@@ -0,0 +1,60 @@
+#ifndef BURST_ALGORITHM_DETAIL_FOR_EACH_SEGMENT_HPP
+#define BURST_ALGORITHM_DETAIL_FOR_EACH_SEGMENT_HPP
+
+#include <burst/iterator/segmented_iterator_traits.hpp>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Обойти сегменты диапазона
+        /*!
+                Принимает диапазон `[first, last)`, заданный сегментированными итераторами, и для
+            каждого сегмента, с которым этот диапазон пересекается, вызывает
+
+                f(segment, local_first, local_last)
+
+            где `[local_first, local_last)` — часть сегмента `segment`, попадающая в диапазон.
+            Сегменты обходятся по порядку. Если функция вернула `false`, то обход прекращается.
+
+                Асимптотика.
+
+            Время: O(S) вызовов функции, S — количество сегментов, с которыми пересекается
+                диапазон.
+            Память: O(1).
+         */
+        template <typename SegmentedIterator, typename Function>
+        void for_each_segment (SegmentedIterator first, SegmentedIterator last, Function f)
+        {
+            using traits = segmented_iterator_traits<SegmentedIterator>;
+
+            if (first == last)
+            {
+                return;
+            }
+
+            auto segment = traits::segment(first);
+            const auto last_segment = traits::segment(last);
+            if (segment == last_segment)
+            {
+                f(segment, traits::local(first), traits::local(last));
+                return;
+            }
+
+            if (not f(segment, traits::local(first), traits::end(segment)))
+            {
+                return;
+            }
+            for (++segment; segment != last_segment; ++segment)
+            {
+                if (not f(segment, traits::begin(segment), traits::end(segment)))
+                {
+                    return;
+                }
+            }
+            f(last_segment, traits::begin(last_segment), traits::local(last));
+        }
+    }
+}
+
+#endif // BURST_ALGORITHM_DETAIL_FOR_EACH_SEGMENT_HPP
@@ -0,0 +1,70 @@
+#ifndef BURST_ALGORITHM_DETAIL_INTERSECTION_SIZE_HPP
+#define BURST_ALGORITHM_DETAIL_INTERSECTION_SIZE_HPP
+
+#include <burst/iterator/detail/intersect_blocks.hpp>
+
+#include <cstddef>
+#include <iterator>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Слить начала двух диапазонов, подсчитывая совпадения.
+        /*!
+                Делает не более `steps` шагов слияния. На каждом шаге сравниваются первые элементы
+            диапазонов: если они равны, то совпадение засчитывается и продвигаются оба диапазона,
+            а если нет — продвигается тот, у которого первый элемент меньше. Шаг не содержит
+            ветвлений, зависящих от значений элементов.
+                Возвращает количество совпадений.
+         */
+        template <typename RandomAccessRange>
+        std::size_t merge_matches (RandomAccessRange & left, RandomAccessRange & right, std::size_t steps)
+        {
+            auto l = left.begin();
+            auto r = right.begin();
+            const auto l_end = left.end();
+            const auto r_end = right.end();
+
+            using difference_type = typename std::iterator_traits<decltype(l)>::difference_type;
+
+            std::size_t matches = 0;
+            for (std::size_t step = 0; step < steps && l != l_end && r != r_end; ++step)
+            {
+                const auto x = *l;
+                const auto y = *r;
+                matches += static_cast<std::size_t>(x == y);
+                l += static_cast<difference_type>(x <= y);
+                r += static_cast<difference_type>(y <= x);
+            }
+
+            left.advance_begin(std::distance(left.begin(), l));
+            right.advance_begin(std::distance(right.begin(), r));
+            return matches;
+        }
+
+        //!     Размер пересечения двух упорядоченных диапазонов целых чисел.
+        /*!
+                Диапазоны рассматриваются как мультимножества: элемент, который встречается в
+            одном диапазоне `a` раз, а в другом — `b` раз, засчитывается `min(a, b)` раз.
+                Не пересекающиеся блоки диапазонов пропускаются целиком (см.
+            `skip_disjoint_blocks`), а там, где блоки пересеклись, диапазоны сливаются без
+            ветвлений (см. `merge_matches`).
+                Оба диапазона продвигаются до конца одного из них.
+         */
+        template <typename RandomAccessRange>
+        std::size_t intersection_size (RandomAccessRange & left, RandomAccessRange & right)
+        {
+            std::size_t size = 0;
+            while (not left.empty() && not right.empty())
+            {
+                skip_disjoint_blocks(left, right);
+                size += merge_matches(left, right, 2 * intersect_block_size);
+            }
+
+            return size;
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_ALGORITHM_DETAIL_INTERSECTION_SIZE_HPP
@@ -0,0 +1,173 @@
+#ifndef BURST_ALGORITHM_DETAIL_MERGE_SPLIT_HPP
+#define BURST_ALGORITHM_DETAIL_MERGE_SPLIT_HPP
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Разрезать слияние набора упорядоченных диапазонов по заданной позиции.
+        /*!
+                Для каждого из диапазонов находит количество его элементов, попадающих в первые
+            `position` элементов слияния, и записывает эти количества в выходной итератор.
+                Равные элементы упорядочиваются по номеру диапазона, а внутри одного диапазона —
+            по позиции. Поэтому позиция каждого элемента в слиянии определена однозначно, и
+            первые элементы диапазонов, отрезанные таким образом, не превосходят всех оставшихся
+            элементов. Значит, части слияния по разные стороны от разреза можно сливать независимо
+            друг от друга.
+
+                Алгоритм работы.
+
+                Для каждого диапазона поддерживается окно `[low, high]`, в котором лежит искомое
+            количество его элементов. Изначально окно — весь диапазон.
+            1. В каждом непустом окне берётся средний элемент, а его вес — размер окна.
+            2. Из этих элементов выбирается взвешенная медиана — опорный элемент.
+            3. Двоичным поиском в каждом диапазоне находится количество его элементов, стоящих в
+               слиянии раньше опорного. Сумма этих количеств — позиция опорного элемента в слиянии.
+            4. Если опорный элемент попадает в первые `position` элементов слияния, то в них
+               попадают и все элементы, стоящие раньше него, поэтому нижние границы всех окон
+               поднимаются до найденных количеств. Иначе в них не попадает ни один элемент,
+               стоящий позже, и до найденных количеств опускаются верхние границы.
+            5. Когда все окна сжались в точку, они и есть ответ.
+
+                Диапазоны, средние элементы которых лежат по ту же сторону от опорного, что и
+            отброшенная часть, теряют по меньшей мере половину окна, а их суммарный вес — не
+            меньше половины общего. Поэтому за каждый шаг суммарный размер окон уменьшается хотя
+            бы на четверть.
+
+                Асимптотика.
+
+            Время: O(k (log(k) + log(n)) log(N)),
+                k — количество диапазонов,
+                n — размер наибольшего из них,
+                N — их суммарный размер.
+            Память: O(k).
+         */
+        template <typename RandomAccessIterator, typename OutputIterator, typename Compare>
+        OutputIterator
+            merge_split
+            (
+                RandomAccessIterator first, RandomAccessIterator last,
+                std::size_t position,
+                OutputIterator result,
+                Compare compare
+            )
+        {
+            using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+
+            const auto range_count = static_cast<std::size_t>(std::distance(first, last));
+            const auto range = [first] (std::size_t index) -> decltype(auto)
+            {
+                return first[static_cast<difference_type>(index)];
+            };
+            const auto element = [& range] (std::size_t index, std::size_t offset) -> decltype(auto)
+            {
+                return *std::next(boost::begin(range(index)), static_cast<std::ptrdiff_t>(offset));
+            };
+
+            std::vector<std::size_t> low(range_count, 0);
+            std::vector<std::size_t> high(range_count);
+            for (std::size_t index = 0; index < range_count; ++index)
+            {
+                high[index] = static_cast<std::size_t>(std::distance(boost::begin(range(index)), boost::end(range(index))));
+            }
+
+            std::vector<std::size_t> candidates;
+            candidates.reserve(range_count);
+            const auto middle = [& low, & high] (std::size_t index)
+            {
+                return low[index] + (high[index] - low[index]) / 2;
+            };
+            const auto precedes = [& compare, & element, & middle] (std::size_t left, std::size_t right)
+            {
+                const auto & left_value = element(left, middle(left));
+                const auto & right_value = element(right, middle(right));
+                return
+                    compare(left_value, right_value) ||
+                    (not compare(right_value, left_value) && left < right);
+            };
+
+            std::vector<std::size_t> bounds(range_count);
+            while (true)
+            {
+                candidates.clear();
+                auto total_weight = std::size_t{0};
+                for (std::size_t index = 0; index < range_count; ++index)
+                {
+                    if (low[index] < high[index])
+                    {
+                        candidates.push_back(index);
+                        total_weight += high[index] - low[index];
+                    }
+                }
+                if (candidates.empty())
+                {
+                    break;
+                }
+
+                std::sort(candidates.begin(), candidates.end(), precedes);
+                auto pivot_range = candidates.front();
+                auto weight = std::size_t{0};
+                for (auto index: candidates)
+                {
+                    weight += high[index] - low[index];
+                    if (2 * weight >= total_weight)
+                    {
+                        pivot_range = index;
+                        break;
+                    }
+                }
+
+                const auto pivot_offset = middle(pivot_range);
+                const auto & pivot = element(pivot_range, pivot_offset);
+                auto rank = std::size_t{0};
+                for (std::size_t index = 0; index < range_count; ++index)
+                {
+                    const auto & other = range(index);
+                    if (index < pivot_range)
+                    {
+                        const auto bound = std::upper_bound(boost::begin(other), boost::end(other), pivot, compare);
+                        bounds[index] = static_cast<std::size_t>(std::distance(boost::begin(other), bound));
+                    }
+                    else if (index > pivot_range)
+                    {
+                        const auto bound = std::lower_bound(boost::begin(other), boost::end(other), pivot, compare);
+                        bounds[index] = static_cast<std::size_t>(std::distance(boost::begin(other), bound));
+                    }
+                    else
+                    {
+                        bounds[index] = pivot_offset;
+                    }
+                    rank += bounds[index];
+                }
+
+                if (rank < position)
+                {
+                    bounds[pivot_range] = pivot_offset + 1;
+                    for (std::size_t index = 0; index < range_count; ++index)
+                    {
+                        low[index] = std::max(low[index], bounds[index]);
+                    }
+                }
+                else
+                {
+                    for (std::size_t index = 0; index < range_count; ++index)
+                    {
+                        high[index] = std::min(high[index], bounds[index]);
+                    }
+                }
+            }
+
+            return std::copy(low.begin(), low.end(), result);
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_ALGORITHM_DETAIL_MERGE_SPLIT_HPP
@@ -0,0 +1,194 @@
+#ifndef BURST_ALGORITHM_DETAIL_VALUE_SPLIT_HPP
+#define BURST_ALGORITHM_DETAIL_VALUE_SPLIT_HPP
+
+#include <burst/execution/detail/parallel_for.hpp>
+#include <burst/execution/parallel_policy.hpp>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Сколько образцов на каждый кусок берётся при выборе разделителей.
+        constexpr const std::size_t value_split_oversampling = 16;
+
+        //!     Выбрать значения, разделяющие набор упорядоченных диапазонов на куски.
+        /*!
+                Из каждого диапазона берутся равноотстоящие образцы, причём шаг выборки один и тот
+            же для всех диапазонов, так что большие диапазоны дают больше образцов. Образцы
+            упорядочиваются, и из них берутся `slice_count - 1` равноотстоящих значений. Повторы
+            выбрасываются, поэтому разделителей может оказаться меньше.
+                Если разрезать каждый из диапазонов по нижним граням разделителей, то все равные
+            друг другу элементы всех диапазонов окажутся в одном и том же куске.
+
+                Асимптотика.
+
+            Время: O(k + s log(s)), где k — количество диапазонов, s — количество кусков.
+            Память: O(k + s).
+         */
+        template <typename RandomAccessIterator, typename Compare>
+        auto
+            select_splitters
+            (
+                RandomAccessIterator first, RandomAccessIterator last,
+                std::size_t slice_count,
+                Compare compare
+            )
+        {
+            using range_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+            using value_type = typename boost::range_value<range_type>::type;
+
+            auto total_size = std::size_t{0};
+            std::for_each(first, last,
+                [& total_size] (const auto & range)
+                {
+                    total_size += static_cast<std::size_t>(boost::size(range));
+                });
+
+            std::vector<value_type> samples;
+            const auto step = std::max<std::size_t>(total_size / (slice_count * value_split_oversampling), 1);
+            std::for_each(first, last,
+                [& samples, step] (const auto & range)
+                {
+                    const auto size = static_cast<std::size_t>(boost::size(range));
+                    for (auto index = step / 2; index < size; index += step)
+                    {
+                        samples.push_back(boost::begin(range)[static_cast<std::ptrdiff_t>(index)]);
+                    }
+                });
+            std::sort(samples.begin(), samples.end(), compare);
+
+            std::vector<value_type> splitters;
+            for (std::size_t slice = 1; slice < slice_count && not samples.empty(); ++slice)
+            {
+                const auto & splitter = samples[slice * samples.size() / slice_count];
+                if (splitters.empty() || compare(splitters.back(), splitter))
+                {
+                    splitters.push_back(splitter);
+                }
+            }
+
+            return splitters;
+        }
+
+        //!     Разрезать упорядоченный диапазон по разделителям.
+        /*!
+                Возвращает границы кусков: начало диапазона, нижние грани всех разделителей и
+            конец диапазона. Кусок с номером `i` — это `[bounds[i], bounds[i + 1])`.
+         */
+        template <typename RandomAccessRange, typename Value, typename Compare>
+        auto cut_by_splitters (const RandomAccessRange & range, const std::vector<Value> & splitters, Compare compare)
+        {
+            using iterator = typename boost::range_iterator<const RandomAccessRange>::type;
+
+            std::vector<iterator> bounds;
+            bounds.reserve(splitters.size() + 2);
+
+            bounds.push_back(boost::begin(range));
+            for (const auto & splitter: splitters)
+            {
+                bounds.push_back(std::lower_bound(bounds.back(), boost::end(range), splitter, compare));
+            }
+            bounds.push_back(boost::end(range));
+
+            return bounds;
+        }
+
+        //!     Параллельно вычислить куски результата и записать их друг за другом.
+        /*!
+                Вызывает `write_slice(i, out)` для каждого куска `i` из `[0, slice_count)` на
+            пуле потоков. Каждый кусок пишется в собственный буфер, а затем буферы по порядку
+            копируются в выходной итератор.
+                Возвращает итератор за последним записанным элементом.
+         */
+        template <typename Value, typename OutputIterator, typename SliceWriter>
+        OutputIterator
+            gather_slices
+            (
+                parallel_policy_t policy,
+                std::size_t slice_count,
+                OutputIterator result,
+                SliceWriter write_slice
+            )
+        {
+            std::vector<std::vector<Value>> buffers(slice_count);
+            parallel_for(policy.thread_count, slice_count,
+                [& buffers, & write_slice] (std::size_t slice)
+                {
+                    write_slice(slice, std::back_inserter(buffers[slice]));
+                });
+
+            for (const auto & buffer: buffers)
+            {
+                result = std::copy(buffer.begin(), buffer.end(), std::move(result));
+            }
+
+            return result;
+        }
+
+        //!     Параллельная операция над набором упорядоченных диапазонов.
+        /*!
+                Режет все диапазоны по общим разделителям, над каждым куском независимо применяет
+            ленивую операцию `operation` — она принимает набор кусков диапазонов и возвращает
+            ленивый диапазон результата — и записывает результаты кусков по порядку в выходной
+            итератор.
+                Операция должна быть такой, что её результат на каждом значении зависит только от
+            элементов, равных этому значению. Таковы пересечение, объединение,
+            полупересечение и симметрическая разность. Тогда результат совпадает с результатом
+            последовательной операции над диапазонами целиком.
+                Входные диапазоны не изменяются.
+         */
+        template <typename RandomAccessRange, typename OutputIterator, typename Compare, typename Operation>
+        OutputIterator
+            split_by_values
+            (
+                parallel_policy_t policy,
+                const RandomAccessRange & ranges,
+                OutputIterator result,
+                Compare compare,
+                Operation operation
+            )
+        {
+            using inner_range_type = typename boost::range_value<RandomAccessRange>::type;
+            using inner_iterator = typename boost::range_iterator<const inner_range_type>::type;
+            using value_type = typename boost::range_value<inner_range_type>::type;
+
+            const auto splitters =
+                select_splitters(boost::begin(ranges), boost::end(ranges), std::max<std::size_t>(policy.thread_count, 1), compare);
+
+            std::vector<std::vector<inner_iterator>> bounds;
+            for (const auto & range: ranges)
+            {
+                bounds.push_back(cut_by_splitters(range, splitters, compare));
+            }
+
+            return
+                gather_slices<value_type>(policy, splitters.size() + 1, std::move(result),
+                    [& bounds, & operation] (std::size_t slice, auto out)
+                    {
+                        std::vector<boost::iterator_range<inner_iterator>> parts;
+                        parts.reserve(bounds.size());
+                        for (const auto & range_bounds: bounds)
+                        {
+                            parts.emplace_back(range_bounds[slice], range_bounds[slice + 1]);
+                        }
+
+                        auto slice_result = operation(parts);
+                        std::copy(slice_result.begin(), slice_result.end(), std::move(out));
+                    });
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_ALGORITHM_DETAIL_VALUE_SPLIT_HPP
@@ -0,0 +1,145 @@
+#ifndef BURST_ALGORITHM_DIFFERENCE_INTO_HPP
+#define BURST_ALGORITHM_DIFFERENCE_INTO_HPP
+
+#include <burst/algorithm/detail/value_split.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/range/detail/skip_to_lower_bound.hpp>
+#include <burst/range/skip_policy.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace burst
+{
+    //!     Разность множеств с записью результата в выходной итератор.
+    /*!
+            Неленивый аналог `burst::difference`: записывает в выходной итератор те элементы
+        уменьшаемого, которых нет в вычитаемом. Диапазоны рассматриваются как мультимножества.
+            Вместо того, чтобы сравнивать первые элементы уменьшаемого и вычитаемого на каждом
+        шаге, находит "скачками" всю серию элементов уменьшаемого, меньших первого элемента
+        вычитаемого, и копирует её целиком одним вызовом `std::copy`. Вычитаемое так же скачками
+        продвигается до первого элемента уменьшаемого. Поэтому разность большого диапазона и
+        небольшого, редко с ним пересекающегося, вычисляется почти за время копирования.
+            Для диапазонов, не являющихся диапазонами произвольного доступа, серии ищутся
+        поэлементно.
+            Входные диапазоны не изменяются.
+            Возвращает итератор за последним записанным элементом.
+
+            Асимптотика.
+
+        Время: O(M log(N / M) + N) в худшем случае, где N — размер уменьшаемого, M — размер
+            вычитаемого, причём слагаемое O(N) — это только копирование.
+        Память: O(1).
+     */
+    template <typename ForwardRange1, typename ForwardRange2, typename OutputIterator, typename Compare>
+    OutputIterator
+        difference_into
+        (
+            const ForwardRange1 & minuend,
+            const ForwardRange2 & subtrahend,
+            OutputIterator result,
+            Compare compare
+        )
+    {
+        auto minuend_rest = boost::make_iterator_range(minuend);
+        auto subtrahend_rest = boost::make_iterator_range(subtrahend);
+        BOOST_ASSERT(std::is_sorted(minuend_rest.begin(), minuend_rest.end(), compare));
+        BOOST_ASSERT(std::is_sorted(subtrahend_rest.begin(), subtrahend_rest.end(), compare));
+
+        while (not minuend_rest.empty() && not subtrahend_rest.empty())
+        {
+            const auto stretch_begin = minuend_rest.begin();
+            detail::skip_to_lower_bound(minuend_rest, subtrahend_rest.front(), compare, galloping_skip);
+            result = std::copy(stretch_begin, minuend_rest.begin(), std::move(result));
+
+            if (minuend_rest.empty())
+            {
+                return result;
+            }
+            else if (not compare(subtrahend_rest.front(), minuend_rest.front()))
+            {
+                minuend_rest.advance_begin(1);
+                subtrahend_rest.advance_begin(1);
+            }
+            else
+            {
+                detail::skip_to_lower_bound(subtrahend_rest, minuend_rest.front(), compare, galloping_skip);
+            }
+        }
+
+        return std::copy(minuend_rest.begin(), minuend_rest.end(), std::move(result));
+    }
+
+    template <typename ForwardRange1, typename ForwardRange2, typename OutputIterator>
+    OutputIterator
+        difference_into
+        (
+            const ForwardRange1 & minuend,
+            const ForwardRange2 & subtrahend,
+            OutputIterator result
+        )
+    {
+        return difference_into(minuend, subtrahend, std::move(result), std::less<>{});
+    }
+
+    //!     Параллельная разность множеств с записью результата в выходной итератор.
+    /*!
+            Значения-разделители выбираются по выборке из уменьшаемого, так что куски
+        уменьшаемого получаются примерно равными. Оба диапазона режутся по нижним граням
+        разделителей, и разность каждой пары кусков вычисляется независимо последовательным
+        `difference_into`. Равные элементы уменьшаемого и вычитаемого всегда попадают в куски с
+        одним и тем же номером, поэтому результат совпадает с последовательной версией.
+            Оба диапазона должны быть диапазонами произвольного доступа.
+     */
+    template <typename RandomAccessRange1, typename RandomAccessRange2, typename OutputIterator, typename Compare>
+    OutputIterator
+        difference_into
+        (
+            parallel_policy_t policy,
+            const RandomAccessRange1 & minuend,
+            const RandomAccessRange2 & subtrahend,
+            OutputIterator result,
+            Compare compare
+        )
+    {
+        using value_type = typename boost::range_value<RandomAccessRange1>::type;
+
+        const auto splitters =
+            detail::select_splitters(&minuend, &minuend + 1, std::max<std::size_t>(policy.thread_count, 1), compare);
+        const auto minuend_bounds = detail::cut_by_splitters(minuend, splitters, compare);
+        const auto subtrahend_bounds = detail::cut_by_splitters(subtrahend, splitters, compare);
+
+        return
+            detail::gather_slices<value_type>(policy, splitters.size() + 1, std::move(result),
+                [& minuend_bounds, & subtrahend_bounds, & compare] (std::size_t slice, auto out)
+                {
+                    difference_into
+                    (
+                        boost::make_iterator_range(minuend_bounds[slice], minuend_bounds[slice + 1]),
+                        boost::make_iterator_range(subtrahend_bounds[slice], subtrahend_bounds[slice + 1]),
+                        std::move(out),
+                        compare
+                    );
+                });
+    }
+
+    template <typename RandomAccessRange1, typename RandomAccessRange2, typename OutputIterator>
+    OutputIterator
+        difference_into
+        (
+            parallel_policy_t policy,
+            const RandomAccessRange1 & minuend,
+            const RandomAccessRange2 & subtrahend,
+            OutputIterator result
+        )
+    {
+        return difference_into(policy, minuend, subtrahend, std::move(result), std::less<>{});
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_DIFFERENCE_INTO_HPP
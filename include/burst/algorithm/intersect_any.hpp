@@ -0,0 +1,44 @@
+#ifndef BURST_ALGORITHM_INTERSECT_ANY_HPP
+#define BURST_ALGORITHM_INTERSECT_ANY_HPP
+
+#include <burst/iterator/end_tag.hpp>
+#include <burst/iterator/intersect_iterator.hpp>
+
+#include <functional>
+#include <utility>
+
+namespace burst
+{
+    struct intersect_any_t
+    {
+        //!     Проверка пересечения на непустоту с предикатом.
+        /*!
+                Принимает на вход тот же набор диапазонов, что и `intersect`, и операцию, задающую
+            отношение строгого порядка на элементах этих диапазонов.
+                Возвращает `true`, если у диапазонов есть хотя бы один общий элемент. Поиск
+            останавливается на первом же общем элементе.
+                Как и при обходе пересечения, внутренние диапазоны в процессе поиска продвигаются.
+         */
+        template <typename RandomAccessRange, typename Compare>
+        bool operator () (RandomAccessRange && ranges, Compare compare) const
+        {
+            const auto intersection =
+                make_intersect_iterator(std::forward<RandomAccessRange>(ranges), compare);
+            return intersection != make_intersect_iterator(iterator::end_tag, intersection);
+        }
+
+        //!     Проверка пересечения на непустоту.
+        /*!
+                Отношение порядка выбирается по-умолчанию.
+         */
+        template <typename RandomAccessRange>
+        bool operator () (RandomAccessRange && ranges) const
+        {
+            return (*this)(std::forward<RandomAccessRange>(ranges), std::less<>{});
+        }
+    };
+
+    constexpr auto intersect_any = intersect_any_t{};
+} // namespace burst
+
+#endif // BURST_ALGORITHM_INTERSECT_ANY_HPP
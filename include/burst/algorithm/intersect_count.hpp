@@ -0,0 +1,106 @@
+#ifndef BURST_ALGORITHM_INTERSECT_COUNT_HPP
+#define BURST_ALGORITHM_INTERSECT_COUNT_HPP
+
+#include <burst/algorithm/detail/intersection_size.hpp>
+#include <burst/iterator/detail/intersect_blocks.hpp>
+#include <burst/iterator/end_tag.hpp>
+#include <burst/iterator/intersect_iterator.hpp>
+
+#include <boost/algorithm/cxx11/is_sorted.hpp>
+#include <boost/assert.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    struct intersect_count_t
+    {
+        //!     Размер пересечения с предикатом.
+        /*!
+                Принимает на вход тот же набор диапазонов, что и `intersect`, и операцию, задающую
+            отношение строгого порядка на элементах этих диапазонов.
+                Возвращает количество элементов, которое было бы в пересечении, но самих элементов
+            не выдаёт.
+                Если пересекаются ровно два диапазона произвольного доступа из целых чисел, а
+            отношение порядка — стандартное "меньше", то не пересекающиеся блоки диапазонов
+            пропускаются целиком, а остальное сливается без ветвлений. В остальных случаях
+            пересечение обходится итератором пересечения.
+                Как и при обходе пересечения, внутренние диапазоны в процессе подсчёта
+            продвигаются.
+         */
+        template <typename RandomAccessRange, typename Compare>
+        std::size_t operator () (RandomAccessRange && ranges, Compare compare) const
+        {
+            using std::begin;
+            using std::end;
+            using inner_range_type =
+                typename boost::range_value<std::remove_reference_t<RandomAccessRange>>::type;
+
+            return
+                count
+                (
+                    begin(std::forward<RandomAccessRange>(ranges)),
+                    end(std::forward<RandomAccessRange>(ranges)),
+                    compare,
+                    detail::is_block_intersectable<inner_range_type, Compare>{}
+                );
+        }
+
+        //!     Размер пересечения.
+        /*!
+                Отношение порядка выбирается по-умолчанию.
+         */
+        template <typename RandomAccessRange>
+        std::size_t operator () (RandomAccessRange && ranges) const
+        {
+            return (*this)(std::forward<RandomAccessRange>(ranges), std::less<>{});
+        }
+
+    private:
+        template <typename RandomAccessIterator, typename Compare>
+        static std::size_t
+            count
+            (
+                RandomAccessIterator first, RandomAccessIterator last,
+                Compare compare,
+                std::true_type
+            )
+        {
+            if (std::distance(first, last) == 2)
+            {
+                auto & left = *first;
+                auto & right = *std::next(first);
+                BOOST_ASSERT(boost::algorithm::is_sorted(left, compare));
+                BOOST_ASSERT(boost::algorithm::is_sorted(right, compare));
+
+                return detail::intersection_size(left, right);
+            }
+
+            return count(first, last, compare, std::false_type{});
+        }
+
+        template <typename RandomAccessIterator, typename Compare>
+        static std::size_t
+            count
+            (
+                RandomAccessIterator first, RandomAccessIterator last,
+                Compare compare,
+                std::false_type
+            )
+        {
+            auto intersection = make_intersect_iterator(first, last, compare);
+            const auto end = make_intersect_iterator(iterator::end_tag, intersection);
+
+            return static_cast<std::size_t>(std::distance(intersection, end));
+        }
+    };
+
+    constexpr auto intersect_count = intersect_count_t{};
+} // namespace burst
+
+#endif // BURST_ALGORITHM_INTERSECT_COUNT_HPP
@@ -0,0 +1,80 @@
+#ifndef BURST_ALGORITHM_INTERSECT_INTO_HPP
+#define BURST_ALGORITHM_INTERSECT_INTO_HPP
+
+#include <burst/algorithm/detail/value_split.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/range/intersect.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace burst
+{
+    //!     Пересечение с записью результата в выходной итератор.
+    /*!
+            Неленивый аналог `burst::intersect`: записывает все элементы пересечения входных
+        диапазонов в выходной итератор.
+            Так же, как и ленивое пересечение, деструктивно по отношению к хранилищу диапазонов.
+            Возвращает итератор за последним записанным элементом.
+     */
+    template <typename RandomAccessRange, typename OutputIterator, typename Compare>
+    OutputIterator intersect_into (RandomAccessRange && ranges, OutputIterator result, Compare compare)
+    {
+        auto intersection = intersect(std::forward<RandomAccessRange>(ranges), compare);
+        return std::copy(intersection.begin(), intersection.end(), std::move(result));
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator>
+    OutputIterator intersect_into (RandomAccessRange && ranges, OutputIterator result)
+    {
+        return intersect_into(std::forward<RandomAccessRange>(ranges), std::move(result), std::less<>{});
+    }
+
+    //!     Параллельное пересечение с записью результата в выходной итератор.
+    /*!
+            Принимает политику параллельного исполнения, набор упорядоченных диапазонов
+        произвольного доступа и выходной итератор.
+            По выборке из элементов входных диапазонов выбираются значения-разделители, по одному
+        на границу между соседними потоками, и каждый входной диапазон режется по нижним граням
+        этих разделителей. Все равные друг другу элементы попадают в один и тот же кусок, поэтому
+        пересечения кусков вычисляются независимо — ленивым `burst::intersect` — и, записанные
+        друг за другом, дают тот же результат, что и последовательное пересечение.
+            В отличие от последовательного пересечения, не изменяет хранилище диапазонов.
+            Возвращает итератор за последним записанным элементом.
+
+            Асимптотика.
+
+        Время: O(T / p + k p log(N)),
+            T — время последовательного пересечения,
+            N — размер наибольшего из входных диапазонов,
+            k — количество входных диапазонов,
+            p — количество потоков.
+        Память: O(R + k p), где R — размер пересечения.
+     */
+    template <typename RandomAccessRange, typename OutputIterator, typename Compare>
+    OutputIterator
+        intersect_into
+        (
+            parallel_policy_t policy,
+            const RandomAccessRange & ranges,
+            OutputIterator result,
+            Compare compare
+        )
+    {
+        return
+            detail::split_by_values(policy, ranges, std::move(result), compare,
+                [compare] (auto & parts)
+                {
+                    return intersect(parts, compare);
+                });
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator>
+    OutputIterator intersect_into (parallel_policy_t policy, const RandomAccessRange & ranges, OutputIterator result)
+    {
+        return intersect_into(policy, ranges, std::move(result), std::less<>{});
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_INTERSECT_INTO_HPP
@@ -0,0 +1,231 @@
+#ifndef BURST_ALGORITHM_MERGE_INTO_HPP
+#define BURST_ALGORITHM_MERGE_INTO_HPP
+
+#include <burst/algorithm/detail/merge_split.hpp>
+#include <burst/execution/detail/parallel_for.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/iterator/detail/front_heap.hpp>
+#include <burst/iterator/detail/merge_heap.hpp>
+
+#include <boost/algorithm/cxx11/is_sorted.hpp>
+#include <boost/assert.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace burst
+{
+    //!     Слияние с записью результата в выходной итератор.
+    /*!
+            Неленивый аналог `burst::merge`: сливает набор упорядоченных диапазонов и записывает
+        все их элементы в выходной итератор.
+            Так же, как и ленивое слияние, работает на пирамиде и переходит в "скачущий" режим,
+        если один и тот же диапазон несколько раз подряд оказывается наименьшим. Но здесь в
+        скачущем режиме найденная серия элементов копируется целиком одним вызовом `std::copy`,
+        что для тривиально копируемых элементов сводится к копированию блока памяти.
+            Так же, как и ленивое слияние, деструктивно по отношению к хранилищу диапазонов: сами
+        диапазоны в нём продвигаются и переставляются.
+            Если элементы диапазонов тривиально копируемы, то пирамида сравнивает копии их первых
+        элементов, сложенные в отдельный плотный массив (см. `detail::cached_fronts`).
+            Возвращает итератор за последним записанным элементом.
+
+            Асимптотика.
+
+        Время: O(N log(k)) в худшем случае и O(k log(k) + R log(N)), если входные диапазоны
+            составлены из R длинных неперемежающихся серий,
+            N — суммарный размер входных диапазонов,
+            k — количество входных диапазонов.
+        Память: O(k), если первые элементы кэшируются, и O(1) иначе.
+     */
+    template <typename RandomAccessIterator, typename OutputIterator, typename Compare>
+    OutputIterator
+        merge_into
+        (
+            RandomAccessIterator first, RandomAccessIterator last,
+            OutputIterator result,
+            Compare compare
+        )
+    {
+        BOOST_ASSERT(std::all_of(first, last,
+            [& compare] (const auto & range)
+            {
+                return boost::algorithm::is_sorted(range, compare);
+            }));
+
+        last = std::remove_if(first, last, [] (const auto & r) {return r.empty();});
+        auto heap_size = static_cast<std::size_t>(std::distance(first, last));
+        auto fronts = detail::front_cache_t<RandomAccessIterator>(first, heap_size);
+        detail::make_front_heap(fronts, heap_size, compare);
+
+        std::size_t streak = 0;
+        while (heap_size != 0)
+        {
+            auto & range = *first;
+            if (heap_size == 1)
+            {
+                return std::copy(range.begin(), range.end(), std::move(result));
+            }
+
+            auto run_end = std::next(range.begin());
+            if (streak >= detail::merge_galloping_threshold)
+            {
+                const auto runner_up = detail::front_heap_runner_up(fronts, heap_size, compare);
+                run_end = detail::merge_run_end(range, fronts.key(runner_up), compare);
+            }
+            result = std::copy(range.begin(), run_end, std::move(result));
+            range.advance_begin(std::distance(range.begin(), run_end));
+
+            if (range.empty())
+            {
+                detail::pop_front_heap(fronts, heap_size, compare);
+                --heap_size;
+                streak = 0;
+            }
+            else
+            {
+                fronts.refresh(0);
+                if (detail::sift_front_heap_down(fronts, 0, heap_size, compare) == 0)
+                {
+                    ++streak;
+                }
+                else
+                {
+                    streak = 0;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    template <typename RandomAccessIterator, typename OutputIterator>
+    OutputIterator merge_into (RandomAccessIterator first, RandomAccessIterator last, OutputIterator result)
+    {
+        return merge_into(std::move(first), std::move(last), std::move(result), std::less<>{});
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator, typename Compare>
+    OutputIterator merge_into (RandomAccessRange && ranges, OutputIterator result, Compare compare)
+    {
+        using std::begin;
+        using std::end;
+        return
+            merge_into
+            (
+                begin(std::forward<RandomAccessRange>(ranges)),
+                end(std::forward<RandomAccessRange>(ranges)),
+                std::move(result),
+                compare
+            );
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator>
+    OutputIterator merge_into (RandomAccessRange && ranges, OutputIterator result)
+    {
+        return merge_into(std::forward<RandomAccessRange>(ranges), std::move(result), std::less<>{});
+    }
+
+    //!     Параллельное слияние с записью результата в выходной итератор.
+    /*!
+            Принимает политику параллельного исполнения, набор упорядоченных диапазонов
+        произвольного доступа и итератор произвольного доступа, в который будет записан результат.
+            Выход делится на равные по размеру куски, по одному на поток. Для границы каждого куска
+        одним совместным поиском по всем входным диапазонам находится, сколько элементов каждого
+        из них попадает в слияние до этой границы (так называемые "co-rank", см.
+        `detail::merge_split`). После этого каждый поток независимо
+        сливает свои части входных диапазонов последовательным `merge_into` прямо в свой кусок
+        выхода.
+            В отличие от последовательного слияния, не изменяет хранилище диапазонов.
+            Возвращает итератор за последним записанным элементом.
+
+            Асимптотика.
+
+        Время: O(N log(k) / p + k log^2(N)),
+            N — суммарный размер входных диапазонов,
+            k — количество входных диапазонов,
+            p — количество потоков.
+        Память: O(p k).
+     */
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Compare>
+    RandomAccessIterator
+        merge_into
+        (
+            parallel_policy_t policy,
+            const RandomAccessRange & ranges,
+            RandomAccessIterator result,
+            Compare compare
+        )
+    {
+        using inner_range_type = typename boost::range_value<RandomAccessRange>::type;
+        using inner_iterator = typename boost::range_iterator<const inner_range_type>::type;
+        using inner_difference_type = typename std::iterator_traits<inner_iterator>::difference_type;
+        using result_difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+
+        const auto range_count = static_cast<std::size_t>(boost::size(ranges));
+        auto total_size = std::size_t{0};
+        for (const auto & range: ranges)
+        {
+            total_size += static_cast<std::size_t>(boost::size(range));
+        }
+
+        const auto chunk_count = std::max<std::size_t>(std::min(policy.thread_count, total_size), 1);
+        const auto chunk_begin = [total_size, chunk_count] (std::size_t chunk)
+        {
+            return total_size / chunk_count * chunk + std::min(chunk, total_size % chunk_count);
+        };
+
+        std::vector<std::size_t> splits((chunk_count + 1) * range_count);
+        detail::parallel_for(policy.thread_count, chunk_count + 1,
+            [&] (std::size_t chunk)
+            {
+                detail::merge_split(boost::begin(ranges), boost::end(ranges), chunk_begin(chunk),
+                    splits.begin() + static_cast<std::ptrdiff_t>(chunk * range_count), compare);
+            });
+
+        detail::parallel_for(policy.thread_count, chunk_count,
+            [&] (std::size_t chunk)
+            {
+                std::vector<boost::iterator_range<inner_iterator>> parts;
+                parts.reserve(range_count);
+
+                auto range = boost::begin(ranges);
+                for (std::size_t index = 0; index < range_count; ++index, ++range)
+                {
+                    const auto first = boost::begin(*range);
+                    parts.emplace_back
+                    (
+                        std::next(first, static_cast<inner_difference_type>(splits[chunk * range_count + index])),
+                        std::next(first, static_cast<inner_difference_type>(splits[(chunk + 1) * range_count + index]))
+                    );
+                }
+
+                merge_into(parts, result + static_cast<result_difference_type>(chunk_begin(chunk)), compare);
+            });
+
+        return result + static_cast<result_difference_type>(total_size);
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator>
+    RandomAccessIterator
+        merge_into
+        (
+            parallel_policy_t policy,
+            const RandomAccessRange & ranges,
+            RandomAccessIterator result
+        )
+    {
+        return merge_into(policy, ranges, std::move(result), std::less<>{});
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_MERGE_INTO_HPP
@@ -0,0 +1,104 @@
+#ifndef BURST_ALGORITHM_SEGMENTED_ACCUMULATE_HPP
+#define BURST_ALGORITHM_SEGMENTED_ACCUMULATE_HPP
+
+#include <burst/algorithm/detail/for_each_segment.hpp>
+#include <burst/iterator/segmented_iterator_traits.hpp>
+
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        template <typename InputIterator, typename Value, typename BinaryOperation>
+        Value
+            segmented_accumulate_impl
+            (
+                InputIterator first, InputIterator last,
+                Value init,
+                BinaryOperation op,
+                std::true_type
+            )
+        {
+            for_each_segment(std::move(first), std::move(last),
+                [& init, & op] (auto, auto local_first, auto local_last)
+                {
+                    init = std::accumulate(local_first, local_last, std::move(init), op);
+                    return true;
+                });
+
+            return init;
+        }
+
+        template <typename InputIterator, typename Value, typename BinaryOperation>
+        Value
+            segmented_accumulate_impl
+            (
+                InputIterator first, InputIterator last,
+                Value init,
+                BinaryOperation op,
+                std::false_type
+            )
+        {
+            return std::accumulate(std::move(first), std::move(last), std::move(init), std::move(op));
+        }
+    }
+
+    //!     Посегментная свёртка
+    /*!
+            По смыслу полностью аналогично `std::accumulate`: сворачивает элементы диапазона по
+        порядку слева направо, начиная с `init`. Если входной итератор сегментирован (см.
+        `segmented_iterator_traits`), то каждый сегмент сворачивается отдельным вызовом
+        `std::accumulate` на локальных итераторах, а результат свёртки одного сегмента становится
+        начальным значением для следующего.
+
+        \tparam BinaryOperation
+            Двухместная операция свёртки. Если пользователем явно не указана операция, то,
+            по-умолчанию, берётся сложение.
+
+            Асимптотика.
+
+        Время: O(N + S), N — размер диапазона, S — количество сегментов.
+        Память: O(1).
+     */
+    template <typename InputIterator, typename Value, typename BinaryOperation>
+    Value segmented_accumulate (InputIterator first, InputIterator last, Value init, BinaryOperation op)
+    {
+        return
+            detail::segmented_accumulate_impl
+            (
+                std::move(first), std::move(last),
+                std::move(init),
+                std::move(op),
+                typename segmented_iterator_traits<InputIterator>::is_segmented_iterator{}
+            );
+    }
+
+    template <typename InputIterator, typename Value>
+    Value segmented_accumulate (InputIterator first, InputIterator last, Value init)
+    {
+        return segmented_accumulate(std::move(first), std::move(last), std::move(init), std::plus<>{});
+    }
+
+    template <typename InputRange, typename Value, typename BinaryOperation>
+    Value segmented_accumulate (InputRange && range, Value init, BinaryOperation op)
+    {
+        using std::begin;
+        using std::end;
+        return segmented_accumulate(begin(range), end(range), std::move(init), std::move(op));
+    }
+
+    template <typename InputRange, typename Value>
+    Value segmented_accumulate (InputRange && range, Value init)
+    {
+        using std::begin;
+        using std::end;
+        return segmented_accumulate(begin(range), end(range), std::move(init));
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEGMENTED_ACCUMULATE_HPP
@@ -0,0 +1,86 @@
+#ifndef BURST_ALGORITHM_SEGMENTED_COPY_HPP
+#define BURST_ALGORITHM_SEGMENTED_COPY_HPP
+
+#include <burst/algorithm/detail/for_each_segment.hpp>
+#include <burst/iterator/segmented_iterator_traits.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        template <typename InputIterator, typename OutputIterator>
+        OutputIterator
+            segmented_copy_impl
+            (
+                InputIterator first, InputIterator last,
+                OutputIterator result,
+                std::true_type
+            )
+        {
+            for_each_segment(std::move(first), std::move(last),
+                [& result] (auto, auto local_first, auto local_last)
+                {
+                    result = std::copy(local_first, local_last, result);
+                    return true;
+                });
+
+            return result;
+        }
+
+        template <typename InputIterator, typename OutputIterator>
+        OutputIterator
+            segmented_copy_impl
+            (
+                InputIterator first, InputIterator last,
+                OutputIterator result,
+                std::false_type
+            )
+        {
+            return std::copy(std::move(first), std::move(last), std::move(result));
+        }
+    }
+
+    //!     Посегментное копирование
+    /*!
+            По смыслу полностью аналогично `std::copy`. Но если входной итератор сегментирован
+        (см. `segmented_iterator_traits`), например, является итератором склейки, то каждый
+        сегмент копируется отдельным вызовом `std::copy` на локальных итераторах. Благодаря этому
+        внутренний цикл не проверяет на каждом шаге, не кончился ли сегмент, и копирование из
+        непрерывных сегментов сводится к копированию памяти.
+            Если итератор не сегментирован, то просто вызывается `std::copy`.
+
+        \return OutputIterator
+            Итератор за последним записанным элементом.
+
+            Асимптотика.
+
+        Время: O(N + S), N — количество копируемых элементов, S — количество сегментов.
+        Память: O(1).
+     */
+    template <typename InputIterator, typename OutputIterator>
+    OutputIterator segmented_copy (InputIterator first, InputIterator last, OutputIterator result)
+    {
+        return
+            detail::segmented_copy_impl
+            (
+                std::move(first), std::move(last),
+                std::move(result),
+                typename segmented_iterator_traits<InputIterator>::is_segmented_iterator{}
+            );
+    }
+
+    template <typename InputRange, typename OutputIterator>
+    OutputIterator segmented_copy (InputRange && range, OutputIterator result)
+    {
+        using std::begin;
+        using std::end;
+        return segmented_copy(begin(range), end(range), std::move(result));
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEGMENTED_COPY_HPP
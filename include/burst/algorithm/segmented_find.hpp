@@ -0,0 +1,79 @@
+#ifndef BURST_ALGORITHM_SEGMENTED_FIND_HPP
+#define BURST_ALGORITHM_SEGMENTED_FIND_HPP
+
+#include <burst/algorithm/detail/for_each_segment.hpp>
+#include <burst/iterator/segmented_iterator_traits.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        template <typename InputIterator, typename Value>
+        InputIterator segmented_find_impl (InputIterator first, InputIterator last, const Value & value, std::true_type)
+        {
+            using traits = segmented_iterator_traits<InputIterator>;
+
+            auto found = last;
+            for_each_segment(first, last,
+                [& first, & found, & value] (auto segment, auto local_first, auto local_last)
+                {
+                    const auto local_found = std::find(local_first, local_last, value);
+                    if (local_found != local_last)
+                    {
+                        found = traits::compose(first, segment, local_found);
+                        return false;
+                    }
+                    return true;
+                });
+
+            return found;
+        }
+
+        template <typename InputIterator, typename Value>
+        InputIterator segmented_find_impl (InputIterator first, InputIterator last, const Value & value, std::false_type)
+        {
+            return std::find(std::move(first), std::move(last), value);
+        }
+    }
+
+    //!     Посегментный поиск
+    /*!
+            По смыслу полностью аналогично `std::find`: возвращает итератор на первый элемент
+        диапазона, равный `value`, или `last`, если такого элемента нет. Если входной итератор
+        сегментирован (см. `segmented_iterator_traits`), то поиск ведётся отдельным вызовом
+        `std::find` в каждом сегменте, а итератор на найденный элемент собирается из сегмента и
+        локального итератора только один раз, в конце.
+
+            Асимптотика.
+
+        Время: O(N + S), N — количество просмотренных элементов, S — количество просмотренных
+            сегментов.
+        Память: O(1).
+     */
+    template <typename InputIterator, typename Value>
+    InputIterator segmented_find (InputIterator first, InputIterator last, const Value & value)
+    {
+        return
+            detail::segmented_find_impl
+            (
+                std::move(first), std::move(last),
+                value,
+                typename segmented_iterator_traits<InputIterator>::is_segmented_iterator{}
+            );
+    }
+
+    template <typename InputRange, typename Value>
+    auto segmented_find (InputRange && range, const Value & value)
+    {
+        using std::begin;
+        using std::end;
+        return segmented_find(begin(range), end(range), value);
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEGMENTED_FIND_HPP
@@ -0,0 +1,71 @@
+#ifndef BURST_ALGORITHM_SEGMENTED_FOR_EACH_HPP
+#define BURST_ALGORITHM_SEGMENTED_FOR_EACH_HPP
+
+#include <burst/algorithm/detail/for_each_segment.hpp>
+#include <burst/iterator/segmented_iterator_traits.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        template <typename InputIterator, typename UnaryFunction>
+        UnaryFunction segmented_for_each_impl (InputIterator first, InputIterator last, UnaryFunction f, std::true_type)
+        {
+            for_each_segment(std::move(first), std::move(last),
+                [& f] (auto, auto local_first, auto local_last)
+                {
+                    std::for_each(local_first, local_last, std::ref(f));
+                    return true;
+                });
+
+            return f;
+        }
+
+        template <typename InputIterator, typename UnaryFunction>
+        UnaryFunction segmented_for_each_impl (InputIterator first, InputIterator last, UnaryFunction f, std::false_type)
+        {
+            return std::for_each(std::move(first), std::move(last), std::move(f));
+        }
+    }
+
+    //!     Посегментный обход
+    /*!
+            По смыслу полностью аналогично `std::for_each`: применяет функцию к каждому элементу
+        диапазона по порядку и возвращает её. Если входной итератор сегментирован (см.
+        `segmented_iterator_traits`), то каждый сегмент обходится отдельным простым циклом по
+        локальным итераторам, который компилятор может векторизовать. Функция при этом не
+        копируется: все сегменты обходит один и тот же её экземпляр.
+
+            Асимптотика.
+
+        Время: O(N + S), N — размер диапазона, S — количество сегментов.
+        Память: O(1).
+     */
+    template <typename InputIterator, typename UnaryFunction>
+    UnaryFunction segmented_for_each (InputIterator first, InputIterator last, UnaryFunction f)
+    {
+        return
+            detail::segmented_for_each_impl
+            (
+                std::move(first), std::move(last),
+                std::move(f),
+                typename segmented_iterator_traits<InputIterator>::is_segmented_iterator{}
+            );
+    }
+
+    template <typename InputRange, typename UnaryFunction>
+    UnaryFunction segmented_for_each (InputRange && range, UnaryFunction f)
+    {
+        using std::begin;
+        using std::end;
+        return segmented_for_each(begin(range), end(range), std::move(f));
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEGMENTED_FOR_EACH_HPP
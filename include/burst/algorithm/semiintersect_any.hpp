@@ -0,0 +1,81 @@
+#ifndef BURST_ALGORITHM_SEMIINTERSECT_ANY_HPP
+#define BURST_ALGORITHM_SEMIINTERSECT_ANY_HPP
+
+#include <burst/algorithm/intersect_any.hpp>
+#include <burst/algorithm/unite_any.hpp>
+#include <burst/iterator/end_tag.hpp>
+#include <burst/iterator/semiintersect_iterator.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    struct semiintersect_any_t
+    {
+        //!     Проверка полупересечения на непустоту с предикатом.
+        /*!
+                Принимает на вход те же аргументы, что и `semiintersect`.
+                Возвращает `true`, если хотя бы один элемент есть не менее чем в `min_items`
+            диапазонах. Поиск останавливается на первом же таком элементе.
+                Полупересечение по одному диапазону непусто, если непуст хотя бы один диапазон, а
+            полупересечение по всем диапазонам — это пересечение. Если диапазонов меньше, чем
+            требуется, то полупересечение пусто.
+                Как и при обходе полупересечения, внутренние диапазоны в процессе поиска
+            продвигаются.
+         */
+        template <typename RandomAccessRange, typename Compare>
+        bool operator () (RandomAccessRange && ranges, std::size_t min_items, Compare compare) const
+        {
+            BOOST_ASSERT_MSG(min_items > 0, "Невозможно получить полупересечение из нуля элементов.");
+
+            using std::begin;
+            using std::end;
+            const auto range_count = static_cast<std::size_t>(std::distance(begin(ranges), end(ranges)));
+
+            if (min_items > range_count)
+            {
+                return false;
+            }
+            else if (min_items == 1)
+            {
+                return unite_any(std::forward<RandomAccessRange>(ranges));
+            }
+            else if (min_items == range_count)
+            {
+                return intersect_any(std::forward<RandomAccessRange>(ranges), compare);
+            }
+            else
+            {
+                const auto semiintersection =
+                    make_semiintersect_iterator
+                    (
+                        std::forward<RandomAccessRange>(ranges),
+                        min_items,
+                        compare
+                    );
+                return
+                    semiintersection !=
+                        make_semiintersect_iterator(iterator::end_tag, semiintersection);
+            }
+        }
+
+        //!     Проверка полупересечения на непустоту.
+        /*!
+                Отношение порядка выбирается по-умолчанию.
+         */
+        template <typename RandomAccessRange>
+        bool operator () (RandomAccessRange && ranges, std::size_t min_items) const
+        {
+            return (*this)(std::forward<RandomAccessRange>(ranges), min_items, std::less<>{});
+        }
+    };
+
+    constexpr auto semiintersect_any = semiintersect_any_t{};
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEMIINTERSECT_ANY_HPP
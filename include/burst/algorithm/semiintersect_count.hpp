@@ -0,0 +1,83 @@
+#ifndef BURST_ALGORITHM_SEMIINTERSECT_COUNT_HPP
+#define BURST_ALGORITHM_SEMIINTERSECT_COUNT_HPP
+
+#include <burst/algorithm/intersect_count.hpp>
+#include <burst/algorithm/unite_count.hpp>
+#include <burst/iterator/end_tag.hpp>
+#include <burst/iterator/semiintersect_iterator.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    struct semiintersect_count_t
+    {
+        //!     Размер полупересечения с предикатом.
+        /*!
+                Принимает на вход те же аргументы, что и `semiintersect`: набор диапазонов,
+            минимальное количество диапазонов, в которых должен быть элемент, и отношение порядка.
+                Возвращает количество элементов, которое было бы в полупересечении, но самих
+            элементов не выдаёт.
+                Полупересечение по одному диапазону — это объединение, а по всем диапазонам — это
+            пересечение, поэтому в этих случаях подсчёт поручается `unite_count` и
+            `intersect_count`. Если диапазонов меньше, чем требуется, то полупересечение пусто.
+            В остальных случаях полупересечение обходится итератором полупересечения.
+                Как и при обходе полупересечения, внутренние диапазоны в процессе подсчёта
+            продвигаются.
+         */
+        template <typename RandomAccessRange, typename Compare>
+        std::size_t operator () (RandomAccessRange && ranges, std::size_t min_items, Compare compare) const
+        {
+            BOOST_ASSERT_MSG(min_items > 0, "Невозможно получить полупересечение из нуля элементов.");
+
+            using std::begin;
+            using std::end;
+            const auto range_count = static_cast<std::size_t>(std::distance(begin(ranges), end(ranges)));
+
+            if (min_items > range_count)
+            {
+                return 0;
+            }
+            else if (min_items == 1)
+            {
+                return unite_count(std::forward<RandomAccessRange>(ranges), compare);
+            }
+            else if (min_items == range_count)
+            {
+                return intersect_count(std::forward<RandomAccessRange>(ranges), compare);
+            }
+            else
+            {
+                auto semiintersection =
+                    make_semiintersect_iterator
+                    (
+                        std::forward<RandomAccessRange>(ranges),
+                        min_items,
+                        compare
+                    );
+                const auto last = make_semiintersect_iterator(iterator::end_tag, semiintersection);
+
+                return static_cast<std::size_t>(std::distance(semiintersection, last));
+            }
+        }
+
+        //!     Размер полупересечения.
+        /*!
+                Отношение порядка выбирается по-умолчанию.
+         */
+        template <typename RandomAccessRange>
+        std::size_t operator () (RandomAccessRange && ranges, std::size_t min_items) const
+        {
+            return (*this)(std::forward<RandomAccessRange>(ranges), min_items, std::less<>{});
+        }
+    };
+
+    constexpr auto semiintersect_count = semiintersect_count_t{};
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEMIINTERSECT_COUNT_HPP
@@ -0,0 +1,82 @@
+#ifndef BURST_ALGORITHM_SEMIINTERSECT_INTO_HPP
+#define BURST_ALGORITHM_SEMIINTERSECT_INTO_HPP
+
+#include <burst/algorithm/detail/value_split.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/range/semiintersect.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace burst
+{
+    //!     Полупересечение с записью результата в выходной итератор.
+    /*!
+            Неленивый аналог `burst::semiintersect`. Так же, как и ленивое полупересечение,
+        деструктивно по отношению к хранилищу диапазонов.
+            Возвращает итератор за последним записанным элементом.
+     */
+    template <typename RandomAccessRange, typename OutputIterator, typename Compare>
+    OutputIterator
+        semiintersect_into
+        (
+            RandomAccessRange && ranges,
+            std::size_t min_items,
+            OutputIterator result,
+            Compare compare
+        )
+    {
+        auto semiintersection = semiintersect(std::forward<RandomAccessRange>(ranges), min_items, compare);
+        return std::copy(semiintersection.begin(), semiintersection.end(), std::move(result));
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator>
+    OutputIterator semiintersect_into (RandomAccessRange && ranges, std::size_t min_items, OutputIterator result)
+    {
+        return semiintersect_into(std::forward<RandomAccessRange>(ranges), min_items, std::move(result), std::less<>{});
+    }
+
+    //!     Параллельное полупересечение с записью результата в выходной итератор.
+    /*!
+            Устроено так же, как и параллельное `intersect_into`: входные диапазоны режутся по
+        общим значениям-разделителям, и в каждом куске полупересечение ищется независимо. Сколько
+        диапазонов содержат элемент, зависит только от равных ему элементов, поэтому куски не
+        влияют друг на друга.
+            Не изменяет хранилище диапазонов.
+     */
+    template <typename RandomAccessRange, typename OutputIterator, typename Compare>
+    OutputIterator
+        semiintersect_into
+        (
+            parallel_policy_t policy,
+            const RandomAccessRange & ranges,
+            std::size_t min_items,
+            OutputIterator result,
+            Compare compare
+        )
+    {
+        return
+            detail::split_by_values(policy, ranges, std::move(result), compare,
+                [min_items, compare] (auto & parts)
+                {
+                    return semiintersect(parts, min_items, compare);
+                });
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator>
+    OutputIterator
+        semiintersect_into
+        (
+            parallel_policy_t policy,
+            const RandomAccessRange & ranges,
+            std::size_t min_items,
+            OutputIterator result
+        )
+    {
+        return semiintersect_into(policy, ranges, min_items, std::move(result), std::less<>{});
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEMIINTERSECT_INTO_HPP
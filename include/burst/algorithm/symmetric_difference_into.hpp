@@ -0,0 +1,66 @@
+#ifndef BURST_ALGORITHM_SYMMETRIC_DIFFERENCE_INTO_HPP
+#define BURST_ALGORITHM_SYMMETRIC_DIFFERENCE_INTO_HPP
+
+#include <burst/algorithm/detail/value_split.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/range/symmetric_difference.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace burst
+{
+    //!     Симметрическая разность с записью результата в выходной итератор.
+    /*!
+            Неленивый аналог `burst::symmetric_difference`. Так же, как и ленивая симметрическая
+        разность, деструктивна по отношению к хранилищу диапазонов.
+            Возвращает итератор за последним записанным элементом.
+     */
+    template <typename RandomAccessRange, typename OutputIterator, typename Compare>
+    OutputIterator symmetric_difference_into (RandomAccessRange && ranges, OutputIterator result, Compare compare)
+    {
+        auto difference = symmetric_difference(std::forward<RandomAccessRange>(ranges), compare);
+        return std::copy(difference.begin(), difference.end(), std::move(result));
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator>
+    OutputIterator symmetric_difference_into (RandomAccessRange && ranges, OutputIterator result)
+    {
+        return symmetric_difference_into(std::forward<RandomAccessRange>(ranges), std::move(result), std::less<>{});
+    }
+
+    //!     Параллельная симметрическая разность с записью результата в выходной итератор.
+    /*!
+            Устроена так же, как и параллельное `intersect_into`. Чётность количества вхождений
+        элемента зависит только от равных ему элементов, а они всегда попадают в один кусок,
+        поэтому симметрическая разность кусков, записанных друг за другом, совпадает с
+        симметрической разностью диапазонов целиком.
+            Не изменяет хранилище диапазонов.
+     */
+    template <typename RandomAccessRange, typename OutputIterator, typename Compare>
+    OutputIterator
+        symmetric_difference_into
+        (
+            parallel_policy_t policy,
+            const RandomAccessRange & ranges,
+            OutputIterator result,
+            Compare compare
+        )
+    {
+        return
+            detail::split_by_values(policy, ranges, std::move(result), compare,
+                [compare] (auto & parts)
+                {
+                    return symmetric_difference(parts, compare);
+                });
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator>
+    OutputIterator symmetric_difference_into (parallel_policy_t policy, const RandomAccessRange & ranges, OutputIterator result)
+    {
+        return symmetric_difference_into(policy, ranges, std::move(result), std::less<>{});
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SYMMETRIC_DIFFERENCE_INTO_HPP
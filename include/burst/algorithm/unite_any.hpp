@@ -0,0 +1,44 @@
+#ifndef BURST_ALGORITHM_UNITE_ANY_HPP
+#define BURST_ALGORITHM_UNITE_ANY_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    struct unite_any_t
+    {
+        //!     Проверка объединения на непустоту.
+        /*!
+                Принимает на вход тот же набор диапазонов, что и `unite`.
+                Объединение непусто тогда и только тогда, когда непуст хотя бы один из
+            объединяемых диапазонов, поэтому ни один элемент не сравнивается, а сами диапазоны не
+            изменяются.
+         */
+        template <typename RandomAccessRange>
+        bool operator () (RandomAccessRange && ranges) const
+        {
+            using std::begin;
+            using std::end;
+            return
+                std::any_of(begin(ranges), end(ranges),
+                    [] (const auto & range) {return not range.empty();});
+        }
+
+        //!     Проверка объединения на непустоту с предикатом.
+        /*!
+                Отношение порядка для ответа не нужно и принимается только для единообразия с
+            `unite`.
+         */
+        template <typename RandomAccessRange, typename Compare>
+        bool operator () (RandomAccessRange && ranges, Compare) const
+        {
+            return (*this)(std::forward<RandomAccessRange>(ranges));
+        }
+    };
+
+    constexpr auto unite_any = unite_any_t{};
+} // namespace burst
+
+#endif // BURST_ALGORITHM_UNITE_ANY_HPP
@@ -0,0 +1,110 @@
+#ifndef BURST_ALGORITHM_UNITE_COUNT_HPP
+#define BURST_ALGORITHM_UNITE_COUNT_HPP
+
+#include <burst/algorithm/detail/intersection_size.hpp>
+#include <burst/iterator/detail/intersect_blocks.hpp>
+#include <burst/iterator/end_tag.hpp>
+#include <burst/iterator/union_iterator.hpp>
+
+#include <boost/algorithm/cxx11/is_sorted.hpp>
+#include <boost/assert.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    struct unite_count_t
+    {
+        //!     Размер объединения с предикатом.
+        /*!
+                Принимает на вход тот же набор диапазонов, что и `unite`, и операцию, задающую
+            отношение строгого порядка на элементах этих диапазонов.
+                Возвращает количество элементов, которое было бы в объединении, но самих элементов
+            не выдаёт.
+                Если объединяются ровно два диапазона произвольного доступа из целых чисел, а
+            отношение порядка — стандартное "меньше", то размер объединения вычисляется как
+            сумма размеров диапазонов за вычетом размера их пересечения, а пересечение
+            подсчитывается так же, как в `intersect_count`. В остальных случаях объединение
+            обходится итератором объединения.
+                Как и при обходе объединения, внутренние диапазоны в процессе подсчёта
+            продвигаются.
+         */
+        template <typename RandomAccessRange, typename Compare>
+        std::size_t operator () (RandomAccessRange && ranges, Compare compare) const
+        {
+            using std::begin;
+            using std::end;
+            using inner_range_type =
+                typename boost::range_value<std::remove_reference_t<RandomAccessRange>>::type;
+
+            return
+                count
+                (
+                    begin(std::forward<RandomAccessRange>(ranges)),
+                    end(std::forward<RandomAccessRange>(ranges)),
+                    compare,
+                    detail::is_block_intersectable<inner_range_type, Compare>{}
+                );
+        }
+
+        //!     Размер объединения.
+        /*!
+                Отношение порядка выбирается по-умолчанию.
+         */
+        template <typename RandomAccessRange>
+        std::size_t operator () (RandomAccessRange && ranges) const
+        {
+            return (*this)(std::forward<RandomAccessRange>(ranges), std::less<>{});
+        }
+
+    private:
+        template <typename RandomAccessIterator, typename Compare>
+        static std::size_t
+            count
+            (
+                RandomAccessIterator first, RandomAccessIterator last,
+                Compare compare,
+                std::true_type
+            )
+        {
+            if (std::distance(first, last) == 2)
+            {
+                auto & left = *first;
+                auto & right = *std::next(first);
+                BOOST_ASSERT(boost::algorithm::is_sorted(left, compare));
+                BOOST_ASSERT(boost::algorithm::is_sorted(right, compare));
+
+                const auto total_size =
+                    static_cast<std::size_t>(std::distance(left.begin(), left.end())) +
+                    static_cast<std::size_t>(std::distance(right.begin(), right.end()));
+                return total_size - detail::intersection_size(left, right);
+            }
+
+            return count(first, last, compare, std::false_type{});
+        }
+
+        template <typename RandomAccessIterator, typename Compare>
+        static std::size_t
+            count
+            (
+                RandomAccessIterator first, RandomAccessIterator last,
+                Compare compare,
+                std::false_type
+            )
+        {
+            auto united = make_union_iterator(first, last, compare);
+            const auto end = make_union_iterator(iterator::end_tag, united);
+
+            return static_cast<std::size_t>(std::distance(united, end));
+        }
+    };
+
+    constexpr auto unite_count = unite_count_t{};
+} // namespace burst
+
+#endif // BURST_ALGORITHM_UNITE_COUNT_HPP
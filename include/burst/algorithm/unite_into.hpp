@@ -0,0 +1,64 @@
+#ifndef BURST_ALGORITHM_UNITE_INTO_HPP
+#define BURST_ALGORITHM_UNITE_INTO_HPP
+
+#include <burst/algorithm/detail/value_split.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/range/unite.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace burst
+{
+    //!     Объединение с записью результата в выходной итератор.
+    /*!
+            Неленивый аналог `burst::unite`. Так же, как и ленивое объединение, деструктивно по
+        отношению к хранилищу диапазонов.
+            Возвращает итератор за последним записанным элементом.
+     */
+    template <typename RandomAccessRange, typename OutputIterator, typename Compare>
+    OutputIterator unite_into (RandomAccessRange && ranges, OutputIterator result, Compare compare)
+    {
+        auto united = unite(std::forward<RandomAccessRange>(ranges), compare);
+        return std::copy(united.begin(), united.end(), std::move(result));
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator>
+    OutputIterator unite_into (RandomAccessRange && ranges, OutputIterator result)
+    {
+        return unite_into(std::forward<RandomAccessRange>(ranges), std::move(result), std::less<>{});
+    }
+
+    //!     Параллельное объединение с записью результата в выходной итератор.
+    /*!
+            Устроено так же, как и параллельное `intersect_into`: входные диапазоны режутся по
+        общим значениям-разделителям, и куски объединяются независимо друг от друга.
+            Не изменяет хранилище диапазонов.
+     */
+    template <typename RandomAccessRange, typename OutputIterator, typename Compare>
+    OutputIterator
+        unite_into
+        (
+            parallel_policy_t policy,
+            const RandomAccessRange & ranges,
+            OutputIterator result,
+            Compare compare
+        )
+    {
+        return
+            detail::split_by_values(policy, ranges, std::move(result), compare,
+                [compare] (auto & parts)
+                {
+                    return unite(parts, compare);
+                });
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator>
+    OutputIterator unite_into (parallel_policy_t policy, const RandomAccessRange & ranges, OutputIterator result)
+    {
+        return unite_into(policy, ranges, std::move(result), std::less<>{});
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_UNITE_INTO_HPP
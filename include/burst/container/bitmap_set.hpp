@@ -0,0 +1,442 @@
+#ifndef BURST_CONTAINER_BITMAP_SET_HPP
+#define BURST_CONTAINER_BITMAP_SET_HPP
+
+#include <burst/integer/countr_zero.hpp>
+#include <burst/integer/divceil.hpp>
+#include <burst/integer/popcount.hpp>
+#include <burst/range/skip_policy.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace burst
+{
+    template <typename Integer>
+    class bitmap_set;
+
+    //!     Итератор битового множества.
+    /*!
+            Хранит номер текущего машинного слова и ещё не пройденные единичные биты этого слова.
+        Текущий элемент — это номер младшего из них. Переход к следующему элементу гасит младший
+        бит, а пустые слова проскакиваются целиком.
+            Как и `boost::counting_iterator`, возвращает ссылку на значение, хранящееся в самом
+        итераторе.
+     */
+    template <typename Integer>
+    class bitmap_set_iterator:
+        public boost::iterator_facade
+        <
+            bitmap_set_iterator<Integer>,
+            Integer,
+            boost::forward_traversal_tag,
+            const Integer &
+        >
+    {
+    private:
+        using word_type = std::uint64_t;
+        static constexpr const std::size_t word_bits = std::numeric_limits<word_type>::digits;
+
+        friend class bitmap_set<Integer>;
+
+    public:
+        bitmap_set_iterator ():
+            m_words(nullptr),
+            m_word_count(0),
+            m_word(0),
+            m_bits(0),
+            m_value{}
+        {
+        }
+
+    private:
+        bitmap_set_iterator (const word_type * words, std::size_t word_count, std::size_t word, word_type bits):
+            m_words(words),
+            m_word_count(word_count),
+            m_word(word),
+            m_bits(bits),
+            m_value{}
+        {
+            skip_empty_words();
+        }
+
+        friend class boost::iterator_core_access;
+
+        void increment ()
+        {
+            m_bits &= m_bits - 1;
+            skip_empty_words();
+        }
+
+        bool equal (const bitmap_set_iterator & that) const
+        {
+            return this->m_word == that.m_word && this->m_bits == that.m_bits;
+        }
+
+        const Integer & dereference () const
+        {
+            return m_value;
+        }
+
+        void skip_empty_words ()
+        {
+            while (m_bits == 0 && m_word + 1 < m_word_count)
+            {
+                m_bits = m_words[++m_word];
+            }
+            if (m_bits == 0)
+            {
+                m_word = m_word_count;
+            }
+            m_value = static_cast<Integer>(position());
+        }
+
+        //!     Номер текущего элемента, а для конца — число, большее номера любого элемента.
+        std::size_t position () const
+        {
+            return m_word * word_bits + static_cast<std::size_t>(countr_zero(m_bits));
+        }
+
+        //!     Продвинуть диапазон битового множества до нижней грани.
+        /*!
+                Сразу переходит к слову, в котором лежит целевой элемент, и гасит в нём младшие
+            биты, так что продвижение не зависит от количества пропущенных элементов и
+            выполняется за время, пропорциональное количеству пропущенных слов.
+                Упорядоченность диапазона гарантируется самим множеством и не проверяется.
+         */
+        template <typename Value, typename Compare, typename SkipPolicy>
+        friend void
+            skip_to_lower_bound
+            (
+                boost::iterator_range<bitmap_set_iterator> & range,
+                const Value & goal,
+                Compare compare,
+                SkipPolicy
+            )
+        {
+            if (not range.empty() && compare(range.front(), goal))
+            {
+                auto first = range.begin();
+                const auto target = static_cast<std::size_t>(goal);
+                if (target / word_bits >= first.m_word_count)
+                {
+                    first = range.end();
+                }
+                else
+                {
+                    if (target / word_bits != first.m_word)
+                    {
+                        first.m_word = target / word_bits;
+                        first.m_bits = first.m_words[first.m_word];
+                    }
+                    first.m_bits &= ~word_type{0} << (target % word_bits);
+                    first.skip_empty_words();
+                }
+
+                if (range.end().position() <= first.position())
+                {
+                    first = range.end();
+                }
+                range = boost::make_iterator_range(first, range.end());
+            }
+        }
+
+        template <typename Value>
+        friend void
+            skip_to_lower_bound
+            (
+                boost::iterator_range<bitmap_set_iterator> & range,
+                const Value & goal
+            )
+        {
+            skip_to_lower_bound(range, goal, std::less<>{}, galloping_skip);
+        }
+
+    private:
+        const word_type * m_words;
+        std::size_t m_word_count;
+        std::size_t m_word;
+        word_type m_bits;
+        Integer m_value;
+    };
+
+    template <typename Integer>
+    constexpr const std::size_t bitmap_set_iterator<Integer>::word_bits;
+
+    //!     Битовое множество неотрицательных целых чисел.
+    /*!
+            Предназначено для плотных множеств: каждое число из отрезка `[0, universe)` занимает
+        ровно один бит, независимо от того, лежит оно в множестве или нет. Если в множестве больше
+        одной шестьдесят четвёртой части чисел отрезка, то это меньше, чем упорядоченный массив
+        64-битных чисел.
+            Множество само по себе является упорядоченным диапазоном, поэтому его можно подавать на
+        вход итераторам пересечения, объединения, разности и т.д. Для диапазона множества
+        определена перегрузка `skip_to_lower_bound`, которая переходит к нужному слову сразу.
+            Кроме того, над множествами с одинаковым отрезком определены операторы `&`, `|`, `-` и
+        `^`, которые вычисляют пересечение, объединение, разность и симметрическую разность
+        пословно — по 64 элемента за одну операцию, — а функции `intersection_size`,
+        `union_size`, `difference_size` и `symmetric_difference_size` подсчитывают размер
+        результата, не создавая его, подсчётом единичных бит.
+
+        \tparam Integer
+            Тип хранимых целых чисел.
+     */
+    template <typename Integer>
+    class bitmap_set
+    {
+        static_assert(std::is_integral<Integer>::value && not std::is_same<Integer, bool>::value,
+            "Битовое множество умеет хранить только целые числа.");
+
+    public:
+        using value_type = Integer;
+        using size_type = std::size_t;
+        using iterator = bitmap_set_iterator<value_type>;
+        using const_iterator = iterator;
+
+    private:
+        using word_type = std::uint64_t;
+        static constexpr const std::size_t word_bits = std::numeric_limits<word_type>::digits;
+
+    public:
+        //!     Пустое множество чисел из отрезка `[0, universe)`.
+        explicit bitmap_set (std::size_t universe):
+            m_universe(universe),
+            m_size(0),
+            m_words(divceil(universe, word_bits), word_type{0})
+        {
+        }
+
+        template <typename InputIterator>
+        bitmap_set (std::size_t universe, InputIterator first, InputIterator last):
+            bitmap_set(universe)
+        {
+            std::for_each(first, last, [this] (const auto & value) {this->insert(value);});
+        }
+
+        bitmap_set (std::size_t universe, std::initializer_list<value_type> values):
+            bitmap_set(universe, values.begin(), values.end())
+        {
+        }
+
+        bitmap_set ():
+            bitmap_set(0)
+        {
+        }
+
+    public:
+        //!     Добавить число в множество.
+        /*!
+                Возвращает `true`, если числа в множестве ещё не было.
+         */
+        bool insert (value_type value)
+        {
+            auto & word = m_words[word_index(value)];
+            const auto bit = bit_mask(value);
+            const auto is_new = (word & bit) == 0;
+            word |= bit;
+            m_size += is_new;
+            return is_new;
+        }
+
+        //!     Удалить число из множества.
+        /*!
+                Возвращает количество удалённых чисел: 0 или 1.
+         */
+        size_type erase (value_type value)
+        {
+            auto & word = m_words[word_index(value)];
+            const auto bit = bit_mask(value);
+            const auto is_present = (word & bit) != 0;
+            word &= ~bit;
+            m_size -= is_present;
+            return is_present;
+        }
+
+        bool contains (value_type value) const
+        {
+            return (m_words[word_index(value)] & bit_mask(value)) != 0;
+        }
+
+        iterator begin () const
+        {
+            return m_words.empty()
+                ? end()
+                : iterator(m_words.data(), m_words.size(), 0, m_words.front());
+        }
+
+        iterator end () const
+        {
+            return iterator(m_words.data(), m_words.size(), m_words.size(), 0);
+        }
+
+        size_type size () const
+        {
+            return m_size;
+        }
+
+        bool empty () const
+        {
+            return m_size == 0;
+        }
+
+        //!     Верхняя граница отрезка, из которого берутся числа.
+        std::size_t universe () const
+        {
+            return m_universe;
+        }
+
+        //!     Объём памяти, занимаемый множеством, в байтах.
+        std::size_t memory_usage () const
+        {
+            return m_words.size() * sizeof(word_type);
+        }
+
+        bitmap_set & operator &= (const bitmap_set & that)
+        {
+            return combine(that, [] (word_type x, word_type y) {return x & y;});
+        }
+
+        bitmap_set & operator |= (const bitmap_set & that)
+        {
+            return combine(that, [] (word_type x, word_type y) {return x | y;});
+        }
+
+        bitmap_set & operator -= (const bitmap_set & that)
+        {
+            return combine(that, [] (word_type x, word_type y) {return x & ~y;});
+        }
+
+        bitmap_set & operator ^= (const bitmap_set & that)
+        {
+            return combine(that, [] (word_type x, word_type y) {return x ^ y;});
+        }
+
+        //!     Количество чисел в результате пословной операции над двумя множествами.
+        /*!
+                Результат операции не сохраняется: каждое слово результата сразу же передаётся в
+            подсчёт единичных бит.
+         */
+        template <typename WordOperation>
+        static size_type combined_size (const bitmap_set & left, const bitmap_set & right, WordOperation operation)
+        {
+            BOOST_ASSERT(left.m_universe == right.m_universe);
+
+            auto size = size_type{0};
+            for (std::size_t i = 0; i < left.m_words.size(); ++i)
+            {
+                size += static_cast<size_type>(popcount(operation(left.m_words[i], right.m_words[i])));
+            }
+            return size;
+        }
+
+    private:
+        std::size_t word_index (value_type value) const
+        {
+            BOOST_ASSERT(static_cast<std::size_t>(value) < m_universe);
+            return static_cast<std::size_t>(value) / word_bits;
+        }
+
+        static word_type bit_mask (value_type value)
+        {
+            return word_type{1} << (static_cast<std::size_t>(value) % word_bits);
+        }
+
+        //!     Пословно применить операцию к этому множеству и данному.
+        /*!
+                Цикл не содержит ветвлений и векторизуется компилятором. Размер результата
+            пересчитывается за тот же проход.
+         */
+        template <typename WordOperation>
+        bitmap_set & combine (const bitmap_set & that, WordOperation operation)
+        {
+            BOOST_ASSERT(this->m_universe == that.m_universe);
+
+            std::transform(m_words.begin(), m_words.end(), that.m_words.begin(), m_words.begin(), operation);
+            m_size = 0;
+            for (auto word: m_words)
+            {
+                m_size += static_cast<size_type>(popcount(word));
+            }
+            return *this;
+        }
+
+    private:
+        std::size_t m_universe;
+        size_type m_size;
+        std::vector<word_type> m_words;
+    };
+
+    template <typename Integer>
+    constexpr const std::size_t bitmap_set<Integer>::word_bits;
+
+    //!     Пересечение битовых множеств.
+    template <typename Integer>
+    bitmap_set<Integer> operator & (bitmap_set<Integer> left, const bitmap_set<Integer> & right)
+    {
+        return left &= right;
+    }
+
+    //!     Объединение битовых множеств.
+    template <typename Integer>
+    bitmap_set<Integer> operator | (bitmap_set<Integer> left, const bitmap_set<Integer> & right)
+    {
+        return left |= right;
+    }
+
+    //!     Разность битовых множеств.
+    template <typename Integer>
+    bitmap_set<Integer> operator - (bitmap_set<Integer> left, const bitmap_set<Integer> & right)
+    {
+        return left -= right;
+    }
+
+    //!     Симметрическая разность битовых множеств.
+    template <typename Integer>
+    bitmap_set<Integer> operator ^ (bitmap_set<Integer> left, const bitmap_set<Integer> & right)
+    {
+        return left ^= right;
+    }
+
+    //!     Размер пересечения битовых множеств.
+    template <typename Integer>
+    std::size_t intersection_size (const bitmap_set<Integer> & left, const bitmap_set<Integer> & right)
+    {
+        return bitmap_set<Integer>::combined_size(left, right,
+            [] (std::uint64_t x, std::uint64_t y) {return x & y;});
+    }
+
+    //!     Размер объединения битовых множеств.
+    template <typename Integer>
+    std::size_t union_size (const bitmap_set<Integer> & left, const bitmap_set<Integer> & right)
+    {
+        return bitmap_set<Integer>::combined_size(left, right,
+            [] (std::uint64_t x, std::uint64_t y) {return x | y;});
+    }
+
+    //!     Размер разности битовых множеств.
+    template <typename Integer>
+    std::size_t difference_size (const bitmap_set<Integer> & left, const bitmap_set<Integer> & right)
+    {
+        return bitmap_set<Integer>::combined_size(left, right,
+            [] (std::uint64_t x, std::uint64_t y) {return x & ~y;});
+    }
+
+    //!     Размер симметрической разности битовых множеств.
+    template <typename Integer>
+    std::size_t symmetric_difference_size (const bitmap_set<Integer> & left, const bitmap_set<Integer> & right)
+    {
+        return bitmap_set<Integer>::combined_size(left, right,
+            [] (std::uint64_t x, std::uint64_t y) {return x ^ y;});
+    }
+} // namespace burst
+
+#endif // BURST_CONTAINER_BITMAP_SET_HPP
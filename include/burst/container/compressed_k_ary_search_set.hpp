@@ -0,0 +1,352 @@
+#ifndef BURST_CONTAINER_COMPRESSED_K_ARY_SEARCH_SET_HPP
+#define BURST_CONTAINER_COMPRESSED_K_ARY_SEARCH_SET_HPP
+
+#include <burst/container/k_ary_search_set.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+#include <burst/integer/to_unsigned.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace burst
+{
+    //!     Сжатое k-местное дерево поиска целых чисел.
+    /*!
+            Устроено так же, как и `k_ary_search_set`, но каждый узел хранится в сжатом виде:
+        отдельно записывается наименьший элемент узла — база, а все (k - 1) элементов узла
+        записываются как разности с базой (дельты). Разрядность дельт выбирается отдельно для
+        каждого уровня дерева — 8, 16, 32 или 64 бита — так, чтобы в неё поместилась наибольшая из
+        дельт уровня.
+            На нижних уровнях дерева элементы узла близки друг к другу, поэтому дельты там узкие, и
+        в одну строку кэша помещается в 2–8 раз больше элементов, чем в несжатом дереве. А именно
+        нижние уровни и составляют подавляющую часть дерева.
+            Поиск внутри узла — это подсчёт дельт, меньших искомой, без ветвлений, который
+        компилятор может векторизовать.
+            Упорядочено по возрастанию: другие отношения порядка не поддерживаются.
+
+        \tparam Integer
+            Тип хранимых целых чисел.
+     */
+    template <typename Integer>
+    class compressed_k_ary_search_set
+    {
+        static_assert(std::is_integral<Integer>::value && not std::is_same<Integer, bool>::value,
+            "Сжатое дерево поиска умеет хранить только целые числа.");
+
+    public:
+        using value_type = Integer;
+        using size_type = std::size_t;
+
+    private:
+        using unsigned_type = std::make_unsigned_t<value_type>;
+
+        //!     Описание одного уровня дерева.
+        /*!
+                Номер первого узла уровня, ширина дельт в байтах и смещение первой дельты уровня
+            в массиве дельт соответствующей ширины.
+         */
+        struct level_type
+        {
+            std::size_t first_node;
+            std::size_t width;
+            std::size_t offset;
+        };
+
+    public:
+        template <typename RandomAccessIterator>
+        compressed_k_ary_search_set
+                (
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    std::size_t arity = k_ary_search_set<value_type>::default_arity
+                ):
+            compressed_k_ary_search_set(k_ary_search_set<value_type>(first, last, arity))
+        {
+        }
+
+        template <typename RandomAccessIterator>
+        compressed_k_ary_search_set
+                (
+                    container::unique_ordered_tag_t,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    std::size_t arity = k_ary_search_set<value_type>::default_arity
+                ):
+            compressed_k_ary_search_set
+            (
+                k_ary_search_set<value_type>(container::unique_ordered_tag, first, last, arity)
+            )
+        {
+        }
+
+        compressed_k_ary_search_set
+                (
+                    std::initializer_list<value_type> values,
+                    std::size_t arity = k_ary_search_set<value_type>::default_arity
+                ):
+            compressed_k_ary_search_set(k_ary_search_set<value_type>(values, arity))
+        {
+        }
+
+        //!     Сжатие готового k-местного дерева поиска.
+        /*!
+                Раскладка узлов и местность берутся из исходного дерева.
+
+                Асимптотика.
+
+            Время: O(N).
+            Память: O(N).
+         */
+        explicit compressed_k_ary_search_set (const k_ary_search_set<value_type> & set):
+            m_arity(set.arity()),
+            m_size(set.size())
+        {
+            compress(set);
+        }
+
+        compressed_k_ary_search_set ():
+            m_arity(0),
+            m_size(0)
+        {
+        }
+
+    public:
+        //!     Проверка наличия элемента в множестве.
+        /*!
+                Асимптотика.
+
+            Время: O(k log_k(N)) операций над узкими дельтами.
+            Память: O(1).
+         */
+        bool contains (value_type value) const
+        {
+            const auto key = to_unsigned(value);
+            const auto node_count = m_bases.size();
+
+            std::size_t node = 0;
+            for (std::size_t level = 0; node < node_count; ++level)
+            {
+                const auto base = m_bases[node];
+                std::size_t child = 0;
+                if (key >= base)
+                {
+                    const auto & description = m_levels[level];
+                    const auto element_count = node_size(node);
+                    const auto deltas_offset =
+                        description.offset + (node - description.first_node) * (m_arity - 1);
+                    const auto delta = static_cast<unsigned_type>(key - base);
+
+                    bool found = false;
+                    switch (description.width)
+                    {
+                        case 1:
+                            child = rank(m_deltas_8.data() + deltas_offset, element_count, delta, found);
+                            break;
+                        case 2:
+                            child = rank(m_deltas_16.data() + deltas_offset, element_count, delta, found);
+                            break;
+                        case 4:
+                            child = rank(m_deltas_32.data() + deltas_offset, element_count, delta, found);
+                            break;
+                        default:
+                            child = rank(m_deltas_64.data() + deltas_offset, element_count, delta, found);
+                            break;
+                    }
+
+                    if (found)
+                    {
+                        return true;
+                    }
+                }
+
+                node = node * m_arity + child + 1;
+            }
+
+            return false;
+        }
+
+        size_type size () const
+        {
+            return m_size;
+        }
+
+        bool empty () const
+        {
+            return m_size == 0;
+        }
+
+        std::size_t arity () const
+        {
+            return m_arity;
+        }
+
+        //!     Объём памяти, занимаемый узлами дерева, в байтах.
+        std::size_t memory_usage () const
+        {
+            return
+                m_bases.size() * sizeof(unsigned_type) +
+                m_deltas_8.size() * sizeof(std::uint8_t) +
+                m_deltas_16.size() * sizeof(std::uint16_t) +
+                m_deltas_32.size() * sizeof(std::uint32_t) +
+                m_deltas_64.size() * sizeof(std::uint64_t);
+        }
+
+    private:
+        //!     Количество элементов в узле.
+        /*!
+                Все узлы, кроме, возможно, последнего, заполнены целиком.
+         */
+        std::size_t node_size (std::size_t node) const
+        {
+            return std::min(m_arity - 1, m_size - node * (m_arity - 1));
+        }
+
+        //!     Количество элементов узла, меньших искомого.
+        /*!
+                Принимает дельты узла и дельту искомого элемента относительно базы узла.
+                Дельты узла упорядочены по возрастанию, поэтому количество дельт, меньших искомой,
+            — это и номер поддерева, в котором нужно продолжить поиск, и позиция, на которой может
+            стоять искомый элемент. Подсчёт ведётся без ветвлений.
+         */
+        template <typename Delta>
+        static std::size_t
+            rank
+            (
+                const Delta * deltas,
+                std::size_t count,
+                unsigned_type delta,
+                bool & found
+            )
+        {
+            if (delta > std::numeric_limits<Delta>::max())
+            {
+                return count;
+            }
+
+            const auto narrow_delta = static_cast<Delta>(delta);
+            std::size_t result = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                result += deltas[i] < narrow_delta;
+            }
+
+            found = result < count && deltas[result] == narrow_delta;
+            return result;
+        }
+
+        void compress (const k_ary_search_set<value_type> & set)
+        {
+            if (m_size == 0)
+            {
+                return;
+            }
+
+            const auto node_capacity = m_arity - 1;
+            const auto node_count = (m_size + node_capacity - 1) / node_capacity;
+            const auto values = set.begin();
+
+            m_bases.resize(node_count);
+            auto first_node = std::size_t{0};
+            while (first_node < node_count)
+            {
+                const auto last_node = std::min(first_node * m_arity + 1, node_count);
+
+                unsigned_type max_delta = 0;
+                for (auto node = first_node; node < last_node; ++node)
+                {
+                    const auto node_begin = values + static_cast<std::ptrdiff_t>(node * node_capacity);
+                    const auto node_end = node_begin + static_cast<std::ptrdiff_t>(node_size(node));
+                    m_bases[node] = to_unsigned(*node_begin);
+                    max_delta =
+                        std::max
+                        (
+                            max_delta,
+                            static_cast<unsigned_type>(to_unsigned(*std::prev(node_end)) - m_bases[node])
+                        );
+                }
+
+                const auto delta_count = (last_node - first_node) * node_capacity;
+                if (max_delta <= std::numeric_limits<std::uint8_t>::max())
+                {
+                    add_level(first_node, last_node, values, m_deltas_8, delta_count);
+                }
+                else if (max_delta <= std::numeric_limits<std::uint16_t>::max())
+                {
+                    add_level(first_node, last_node, values, m_deltas_16, delta_count);
+                }
+                else if (max_delta <= std::numeric_limits<std::uint32_t>::max())
+                {
+                    add_level(first_node, last_node, values, m_deltas_32, delta_count);
+                }
+                else
+                {
+                    add_level(first_node, last_node, values, m_deltas_64, delta_count);
+                }
+
+                first_node = first_node * m_arity + 1;
+            }
+
+            m_deltas_8.shrink_to_fit();
+            m_deltas_16.shrink_to_fit();
+            m_deltas_32.shrink_to_fit();
+            m_deltas_64.shrink_to_fit();
+        }
+
+        //!     Записать дельты всех узлов уровня в массив дельт заданной ширины.
+        /*!
+                Хвост неполного последнего узла заполняется наибольшим значением дельты, хотя при
+            поиске он и не просматривается.
+         */
+        template <typename RandomAccessIterator, typename Delta>
+        void
+            add_level
+            (
+                std::size_t first_node,
+                std::size_t last_node,
+                RandomAccessIterator values,
+                std::vector<Delta> & deltas,
+                std::size_t delta_count
+            )
+        {
+            const auto node_capacity = m_arity - 1;
+            m_levels.push_back(level_type{first_node, sizeof(Delta), deltas.size()});
+            deltas.reserve(deltas.size() + delta_count);
+
+            for (auto node = first_node; node < last_node; ++node)
+            {
+                const auto node_begin = values + static_cast<std::ptrdiff_t>(node * node_capacity);
+                const auto element_count = node_size(node);
+                for (std::size_t i = 0; i < element_count; ++i)
+                {
+                    const auto value = to_unsigned(node_begin[static_cast<std::ptrdiff_t>(i)]);
+                    deltas.push_back(static_cast<Delta>(value - m_bases[node]));
+                }
+                deltas.resize(deltas.size() + node_capacity - element_count,
+                    std::numeric_limits<Delta>::max());
+            }
+            BOOST_ASSERT(deltas.size() == m_levels.back().offset + delta_count);
+        }
+
+    private:
+        std::size_t m_arity;
+        std::size_t m_size;
+
+        std::vector<unsigned_type> m_bases;
+        std::vector<level_type> m_levels;
+
+        std::vector<std::uint8_t> m_deltas_8;
+        std::vector<std::uint16_t> m_deltas_16;
+        std::vector<std::uint32_t> m_deltas_32;
+        std::vector<std::uint64_t> m_deltas_64;
+    };
+} // namespace burst
+
+#endif // BURST_CONTAINER_COMPRESSED_K_ARY_SEARCH_SET_HPP
@@ -0,0 +1,484 @@
+#ifndef BURST_CONTAINER_COMPRESSED_POSTING_LIST_HPP
+#define BURST_CONTAINER_COMPRESSED_POSTING_LIST_HPP
+
+#include <burst/container/unique_ordered_tag.hpp>
+#include <burst/range/detail/skip_to_lower_bound.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace burst
+{
+    template <typename Integer>
+    class compressed_posting_list;
+
+    //!     Итератор сжатого списка.
+    /*!
+            Хранит номер текущего элемента и его значение. Переход к следующему элементу — это
+        извлечение одной дельты из упакованного блока и сложение, так что обход списка читает из
+        памяти только упакованные дельты.
+            Выдаёт константную ссылку на значение, хранящееся в самом итераторе, так что
+        записать через итератор ничего нельзя.
+     */
+    template <typename Integer>
+    class compressed_posting_list_iterator:
+        public boost::iterator_facade
+        <
+            compressed_posting_list_iterator<Integer>,
+            Integer,
+            boost::forward_traversal_tag,
+            const Integer &
+        >
+    {
+    private:
+        using list_type = compressed_posting_list<Integer>;
+        friend class compressed_posting_list<Integer>;
+
+    public:
+        compressed_posting_list_iterator ():
+            m_list(nullptr),
+            m_index(0),
+            m_value{}
+        {
+        }
+
+    private:
+        compressed_posting_list_iterator (const list_type & list, std::size_t index, Integer value):
+            m_list(std::addressof(list)),
+            m_index(index),
+            m_value(value)
+        {
+        }
+
+        friend class boost::iterator_core_access;
+
+        void increment ()
+        {
+            m_value = m_list->next_value(m_index, m_value);
+            ++m_index;
+        }
+
+        bool equal (const compressed_posting_list_iterator & that) const
+        {
+            return this->m_index == that.m_index;
+        }
+
+        const Integer & dereference () const
+        {
+            return m_value;
+        }
+
+        template <typename Value, typename Compare, typename SkipPolicy>
+        compressed_posting_list_iterator
+            lower_bound
+            (
+                const compressed_posting_list_iterator & last,
+                const Value & goal,
+                Compare compare,
+                SkipPolicy policy
+            )
+            const
+        {
+            return m_list->lower_bound(*this, last, goal, compare, policy);
+        }
+
+        //!     Продвинуть диапазон сжатого списка до нижней грани.
+        /*!
+                Блоки, которые целиком меньше целевого элемента, пропускаются по индексу первых
+            элементов блоков способом, заданным политикой, и не распаковываются. Распаковывается
+            только тот блок, в котором лежит нижняя грань.
+                Диапазон и так упорядочен по построению, поэтому упорядоченность не проверяется.
+         */
+        template <typename Value, typename Compare, typename SkipPolicy>
+        friend void
+            skip_to_lower_bound
+            (
+                boost::iterator_range<compressed_posting_list_iterator> & range,
+                const Value & goal,
+                Compare compare,
+                SkipPolicy policy
+            )
+        {
+            if (not range.empty() && compare(range.front(), goal))
+            {
+                range = boost::make_iterator_range
+                (
+                    range.begin().lower_bound(range.end(), goal, compare, policy),
+                    range.end()
+                );
+            }
+        }
+
+        template <typename Value>
+        friend void
+            skip_to_lower_bound
+            (
+                boost::iterator_range<compressed_posting_list_iterator> & range,
+                const Value & goal
+            )
+        {
+            skip_to_lower_bound(range, goal, std::less<>{}, galloping_skip);
+        }
+
+    private:
+        const list_type * m_list;
+        std::size_t m_index;
+        Integer m_value;
+    };
+
+    //!     Сжатый упорядоченный список целых чисел.
+    /*!
+            Предназначен для хранения больших упорядоченных списков идентификаторов, например,
+        списков вхождений обратного индекса, которые затем пересекаются, объединяются и т.п.
+            Элементы разбиты на блоки по `block_size` штук. Первый элемент каждого блока хранится
+        целиком в отдельном массиве — индексе пропусков, — а остальные записываются как разности
+        с предыдущим элементом (дельты), упакованные по `b` бит, где `b` — разрядность наибольшей
+        дельты блока. Для плотных списков это от единиц до полутора десятков бит на элемент вместо
+        64-х.
+            Диапазон списка (`boost::make_iterator_range(list)`) подходит для итераторов
+        пересечения, объединения, полупересечения и т.д. без каких-либо изменений: для него
+        определена быстрая перегрузка `skip_to_lower_bound`, которая перескакивает целые блоки по
+        индексу пропусков.
+            Повторяющиеся элементы сохраняются. Упорядочено по возрастанию: другие отношения
+        порядка не поддерживаются.
+
+        \tparam Integer
+            Тип хранимых целых чисел.
+     */
+    template <typename Integer>
+    class compressed_posting_list
+    {
+        static_assert(std::is_integral<Integer>::value && not std::is_same<Integer, bool>::value,
+            "Сжатый список умеет хранить только целые числа.");
+
+    public:
+        using value_type = Integer;
+        using size_type = std::size_t;
+        using iterator = compressed_posting_list_iterator<value_type>;
+        using const_iterator = iterator;
+
+        //!     Количество элементов в блоке.
+        static constexpr const std::size_t block_size = 128;
+
+    private:
+        friend class compressed_posting_list_iterator<value_type>;
+
+        using unsigned_type = std::make_unsigned_t<value_type>;
+        using word_type = std::uint64_t;
+        static constexpr const std::size_t word_bits = std::numeric_limits<word_type>::digits;
+
+    public:
+        template <typename ForwardIterator>
+        compressed_posting_list (ForwardIterator first, ForwardIterator last):
+            compressed_posting_list(sorted(std::vector<value_type>(first, last)))
+        {
+        }
+
+        //!     Сжатие уже упорядоченной последовательности.
+        /*!
+                Асимптотика.
+
+            Время: O(N).
+            Память: O(N).
+         */
+        template <typename ForwardIterator>
+        compressed_posting_list (container::unique_ordered_tag_t, ForwardIterator first, ForwardIterator last):
+            m_size(0)
+        {
+            BOOST_ASSERT(std::is_sorted(first, last));
+            compress(first, last);
+        }
+
+        compressed_posting_list (std::initializer_list<value_type> values):
+            compressed_posting_list(values.begin(), values.end())
+        {
+        }
+
+        compressed_posting_list ():
+            m_size(0)
+        {
+        }
+
+    public:
+        iterator begin () const
+        {
+            return iterator(*this, 0, empty() ? value_type{} : m_block_fronts.front());
+        }
+
+        iterator end () const
+        {
+            return iterator(*this, m_size, value_type{});
+        }
+
+        size_type size () const
+        {
+            return m_size;
+        }
+
+        bool empty () const
+        {
+            return m_size == 0;
+        }
+
+        //!     Объём памяти, занимаемый списком, в байтах.
+        std::size_t memory_usage () const
+        {
+            return
+                m_block_fronts.size() * sizeof(value_type) +
+                m_widths.size() * sizeof(std::uint8_t) +
+                m_offsets.size() * sizeof(std::size_t) +
+                m_words.size() * sizeof(word_type);
+        }
+
+    private:
+        explicit compressed_posting_list (const std::vector<value_type> & values):
+            m_size(0)
+        {
+            compress(values.begin(), values.end());
+        }
+
+        static std::vector<value_type> sorted (std::vector<value_type> values)
+        {
+            std::sort(values.begin(), values.end());
+            return values;
+        }
+
+        template <typename ForwardIterator>
+        void compress (ForwardIterator first, ForwardIterator last)
+        {
+            std::array<word_type, block_size> deltas;
+            while (first != last)
+            {
+                const auto front = *first;
+                auto previous = front;
+                ++first;
+
+                deltas[0] = 0;
+                auto count = std::size_t{1};
+                auto max_delta = word_type{0};
+                for (; count < block_size && first != last; ++count, ++first)
+                {
+                    deltas[count] = static_cast<unsigned_type>(to_unsigned_type(*first) - to_unsigned_type(previous));
+                    max_delta = std::max(max_delta, deltas[count]);
+                    previous = *first;
+                }
+                std::fill(deltas.begin() + static_cast<std::ptrdiff_t>(count), deltas.end(), word_type{0});
+
+                const auto width = bit_width(max_delta);
+                m_block_fronts.push_back(front);
+                m_widths.push_back(static_cast<std::uint8_t>(width));
+                m_offsets.push_back(m_words.size());
+                m_words.resize(m_words.size() + block_size * width / word_bits, word_type{0});
+                pack(deltas.data(), width, m_words.data() + m_offsets.back());
+
+                m_size += count;
+            }
+        }
+
+        static constexpr unsigned_type to_unsigned_type (value_type value)
+        {
+            return static_cast<unsigned_type>(value);
+        }
+
+        static std::size_t bit_width (word_type value)
+        {
+            auto width = std::size_t{0};
+            while (value != 0)
+            {
+                value >>= 1;
+                ++width;
+            }
+            return width;
+        }
+
+        static constexpr word_type low_bits_mask (std::size_t width)
+        {
+            return width == word_bits ? ~word_type{0} : (word_type{1} << width) - 1;
+        }
+
+        //!     Упаковать дельты блока.
+        /*!
+                Дельта с номером `i` занимает биты `[i * width, (i + 1) * width)` блока и может
+            лежать на стыке двух соседних машинных слов. Блок занимает ровно `2 * width` слов.
+         */
+        static void pack (const word_type * deltas, std::size_t width, word_type * words)
+        {
+            for (std::size_t index = 0; index < block_size && width != 0; ++index)
+            {
+                const auto bit = index * width;
+                const auto word = words + bit / word_bits;
+                const auto shift = bit % word_bits;
+
+                word[0] |= deltas[index] << shift;
+                if (shift + width > word_bits)
+                {
+                    word[1] |= deltas[index] >> (word_bits - shift);
+                }
+            }
+        }
+
+        //!     Извлечь дельту с номером `index` из упакованного блока.
+        static word_type unpack (const word_type * words, std::size_t width, std::size_t index)
+        {
+            if (width == 0)
+            {
+                return 0;
+            }
+
+            const auto bit = index * width;
+            const auto word = words + bit / word_bits;
+            const auto shift = bit % word_bits;
+
+            auto result = word[0] >> shift;
+            if (shift + width > word_bits)
+            {
+                result |= word[1] << (word_bits - shift);
+            }
+            return result & low_bits_mask(width);
+        }
+
+        static value_type add (value_type value, word_type delta)
+        {
+            return static_cast<value_type>(static_cast<unsigned_type>(to_unsigned_type(value) + delta));
+        }
+
+        //!     Значение элемента, следующего за элементом с номером `index` и значением `value`.
+        value_type next_value (std::size_t index, value_type value) const
+        {
+            const auto next = index + 1;
+            const auto block = next / block_size;
+            if (next % block_size == 0)
+            {
+                return next < m_size ? m_block_fronts[block] : value_type{};
+            }
+            else
+            {
+                return add(value, unpack(m_words.data() + m_offsets[block], m_widths[block], next % block_size));
+            }
+        }
+
+        //!     Найти нижнюю грань целевого элемента в диапазоне `[first, last)`.
+        /*!
+                Сначала по индексу пропусков ищется последний блок, первый элемент которого меньше
+            целевого. Нижняя грань лежит либо в этом блоке, либо в начале следующего.
+                Внутри блока нижняя грань ищется поэлементно: на пересечениях реальных списков
+            это оказалось быстрее, чем распаковывать блок целиком и искать двоичным поиском, потому
+            что продвижение обычно заканчивается в первых элементах блока.
+
+                Асимптотика.
+
+            Время: O(log(B) + block_size), где B — количество пропускаемых блоков.
+            Память: O(1).
+         */
+        template <typename Value, typename Compare, typename SkipPolicy>
+        iterator
+            lower_bound
+            (
+                const iterator & first,
+                const iterator & last,
+                const Value & goal,
+                Compare compare,
+                SkipPolicy policy
+            )
+            const
+        {
+            const auto first_block = first.m_index / block_size;
+            const auto end_block = (last.m_index + block_size - 1) / block_size;
+
+            auto fronts =
+                boost::make_iterator_range
+                (
+                    m_block_fronts.begin() + static_cast<std::ptrdiff_t>(first_block + 1),
+                    m_block_fronts.begin() + static_cast<std::ptrdiff_t>(end_block)
+                );
+            detail::skip_to_lower_bound(fronts, goal, compare, policy);
+            const auto block = static_cast<std::size_t>(fronts.begin() - m_block_fronts.begin()) - 1;
+
+            const auto block_begin = block * block_size;
+            const auto limit = std::min(last.m_index, block_begin + block_size);
+
+            auto index = block_begin;
+            auto value = m_block_fronts[block];
+            if (block == first_block)
+            {
+                index = first.m_index;
+                value = first.m_value;
+            }
+            scan(block, index, value, limit, goal, compare);
+
+            if (index < limit)
+            {
+                return iterator(*this, index, value);
+            }
+            else if (limit < last.m_index)
+            {
+                return iterator(*this, limit, m_block_fronts[block + 1]);
+            }
+            else
+            {
+                return last;
+            }
+        }
+
+        //!     Поэлементно продвинуться внутри блока до нижней грани.
+        /*!
+                Разрядность и начало упакованных дельт блока находятся один раз на всё
+            продвижение. Если нижней грани в блоке до элемента `limit` нет, то `index` становится
+            равным `limit`.
+         */
+        template <typename Value, typename Compare>
+        void
+            scan
+            (
+                std::size_t block,
+                std::size_t & index,
+                value_type & value,
+                std::size_t limit,
+                const Value & goal,
+                Compare compare
+            )
+            const
+        {
+            const auto width = std::size_t{m_widths[block]};
+            const auto words = m_words.data() + m_offsets[block];
+
+            while (compare(value, goal))
+            {
+                if (++index == limit)
+                {
+                    return;
+                }
+                value = add(value, unpack(words, width, index % block_size));
+            }
+        }
+
+    private:
+        std::size_t m_size;
+
+        std::vector<value_type> m_block_fronts;
+        std::vector<std::uint8_t> m_widths;
+        std::vector<std::size_t> m_offsets;
+        std::vector<word_type> m_words;
+    };
+
+    template <typename Integer>
+    constexpr const std::size_t compressed_posting_list<Integer>::block_size;
+
+    template <typename Integer>
+    constexpr const std::size_t compressed_posting_list<Integer>::word_bits;
+} // namespace burst
+
+#endif // BURST_CONTAINER_COMPRESSED_POSTING_LIST_HPP
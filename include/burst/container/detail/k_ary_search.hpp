@@ -0,0 +1,82 @@
+#ifndef BURST_CONTAINER_DETAIL_K_ARY_SEARCH_HPP
+#define BURST_CONTAINER_DETAIL_K_ARY_SEARCH_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Индекс первого элемента дочернего узла в массиве k-местного дерева.
+        /*!
+                Узел, начинающийся с индекса `parent_index`, и его `child_number`-й потомок
+            расположены в массиве по принципу, схожему с пирамидой.
+         */
+        inline std::size_t
+            k_ary_tree_child_index
+            (
+                std::size_t arity,
+                std::size_t parent_index,
+                std::size_t child_number
+            )
+        {
+            return parent_index * arity + (child_number + 1) * (arity - 1);
+        }
+
+        //!     Поиск элемента в массиве, хранящем k-местное дерево поиска.
+        /*!
+                Спускается от корня дерева к листьям, в каждом узле ища искомый элемент двоичным
+            поиском.
+                Возвращает итератор на найденный элемент, либо `last`, если элемента в дереве нет.
+
+                Асимптотика.
+
+            Время: O(log_k(N)).
+            Память: O(1).
+         */
+        template <typename RandomAccessIterator, typename Value, typename Compare>
+        RandomAccessIterator
+            k_ary_search
+            (
+                RandomAccessIterator first, RandomAccessIterator last,
+                std::size_t arity,
+                const Value & value,
+                Compare compare
+            )
+        {
+            using difference_type =
+                typename std::iterator_traits<RandomAccessIterator>::difference_type;
+
+            const auto size = static_cast<std::size_t>(std::distance(first, last));
+            std::size_t node_index = 0;
+
+            while (node_index < size)
+            {
+                const auto node_begin = first + static_cast<difference_type>(node_index);
+                const auto node_end =
+                    node_begin + static_cast<difference_type>(std::min(arity - 1, size - node_index));
+
+                const auto search_result = std::lower_bound(node_begin, node_end, value, compare);
+                if (search_result != node_end && not compare(value, *search_result))
+                {
+                    return search_result;
+                }
+                else
+                {
+                    node_index = k_ary_tree_child_index
+                    (
+                        arity,
+                        node_index,
+                        static_cast<std::size_t>(std::distance(node_begin, search_result))
+                    );
+                }
+            }
+
+            return last;
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_CONTAINER_DETAIL_K_ARY_SEARCH_HPP
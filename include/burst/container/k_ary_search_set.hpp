@@ -1,7 +1,11 @@
 #ifndef BURST_CONTAINER_K_ARY_SEARCH_SET_HPP
 #define BURST_CONTAINER_K_ARY_SEARCH_SET_HPP
 
+#include <burst/algorithm/radix_sort.hpp>
+#include <burst/container/detail/k_ary_search.hpp>
 #include <burst/container/unique_ordered_tag.hpp>
+#include <burst/execution/detail/parallel_for.hpp>
+#include <burst/execution/parallel_policy.hpp>
 #include <burst/functional/not_fn.hpp>
 #include <burst/integer/intlog.hpp>
 #include <burst/integer/intpow.hpp>
@@ -15,12 +19,34 @@
 #include <functional>
 #include <initializer_list>
 #include <iterator>
-#include <stack>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace burst
 {
+    namespace detail
+    {
+        //!     Можно ли упорядочить элементы множества поразрядной сортировкой.
+        /*!
+                Можно, если элементы — целые числа, а отношение порядка — стандартное "меньше",
+            то есть совпадает с порядком, который даёт поразрядная сортировка.
+         */
+        template <typename Value, typename Compare>
+        struct is_radix_sortable_set:
+            std::integral_constant
+            <
+                bool,
+                std::is_integral<Value>::value && not std::is_same<Value, bool>::value &&
+                (
+                    std::is_same<Compare, std::less<>>::value ||
+                    std::is_same<Compare, std::less<Value>>::value
+                )
+            >
+        {
+        };
+    } // namespace detail
+
     struct k_ary_search_set_branch
     {
         std::size_t index;
@@ -68,6 +94,10 @@ namespace burst
         using size_type = typename value_container_type::size_type;
         using difference_type = typename value_container_type::difference_type;
 
+    public:
+        //!     Местность дерева, которая используется, если пользователь не задал её явно.
+        static const std::size_t default_arity = 33;
+
     public:
         //!     Создание множества из упорядоченного набора, представленного итераторами.
         /*!
@@ -79,7 +109,7 @@ namespace burst
                 Асимптотика.
 
             Время: O(N), N = |[first, last)| — размер дерева.
-            Память: O(log_k(N) + k).
+            Память: O(log_k(N)).
                 Учитывается только собственная память конструктора. Созданное дерево, естественно,
                 содержит ровно N элементов.
          */
@@ -107,10 +137,11 @@ namespace burst
                 Асимптотика.
 
             Время:
-                1. O(N), если набор упорядочен.
+                1. O(N), если набор упорядочен или если элементы — целые числа, упорядоченные
+                   стандартным отношением "меньше".
                 2. O(N logN), если набор неупорядочен,
                 где N = |[first, last)|.
-            Память: O(log_k(N) + k).
+            Память: O(log_k(N)).
          */
         template <typename RandomAccessIterator>
         k_ary_search_set
@@ -126,6 +157,53 @@ namespace burst
             initialize(boost::make_iterator_range(first, last));
         }
 
+        //!     Параллельное создание множества из упорядоченного набора.
+        /*!
+                Аналогично созданию из упорядоченного набора, представленного итераторами, но
+            заполняет дерево в несколько потоков в соответствии с заданной политикой исполнения.
+
+                Асимптотика.
+
+            Время: O(N / P + P * k), P — количество потоков.
+            Память: O(log_k(N) + P * k).
+         */
+        template <typename RandomAccessIterator>
+        k_ary_search_set
+                (
+                    parallel_policy_t policy,
+                    container::unique_ordered_tag_t,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    std::size_t arity = default_arity,
+                    const value_compare & compare = value_compare()
+                ):
+            m_values(static_cast<size_type>(std::distance(first, last))),
+            m_arity(arity),
+            m_compare(compare)
+        {
+            initialize_trusted(boost::make_iterator_range(first, last), policy);
+        }
+
+        //!     Параллельное создание множества из набора, заданного итераторами.
+        /*!
+                Если набор неупорядочен, то он сначала упорядочивается в вызывающем потоке, а затем
+            дерево заполняется в несколько потоков.
+         */
+        template <typename RandomAccessIterator>
+        k_ary_search_set
+                (
+                    parallel_policy_t policy,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    std::size_t arity = default_arity,
+                    const value_compare & compare = value_compare()
+                ):
+            m_arity(arity),
+            m_compare(compare)
+        {
+            initialize(boost::make_iterator_range(first, last), policy);
+        }
+
         //!     Создание множества из упорядоченного набора, представленного списком инициализации.
         /*!
                 Принимает std::initializer_list, заполненный элементами которые должны быть в
@@ -136,7 +214,7 @@ namespace burst
                 Асимптотика.
 
             Время: O(N), где N = |values|.
-            Память: O(log_k(N) + k).
+            Память: O(log_k(N)).
          */
         k_ary_search_set
                 (
@@ -160,10 +238,11 @@ namespace burst
                 Асимптотика.
 
             Время:
-                1. O(N), если набор упорядочен.
+                1. O(N), если набор упорядочен или если элементы — целые числа, упорядоченные
+                   стандартным отношением "меньше".
                 2. O(N logN), если набор неупорядочен,
                 где N = |values|.
-            Память: O(log_k(N) + k).
+            Память: O(log_k(N)).
          */
         k_ary_search_set
                 (
@@ -205,6 +284,84 @@ namespace burst
             return find_impl(value);
         }
 
+        //!     Поиск упорядоченной последовательности элементов.
+        /*!
+                Принимает последовательность элементов, упорядоченную относительно отношения
+            порядка множества, и записывает в выходной итератор те из них, которые есть в
+            множестве, сохраняя их порядок.
+                Пользуется упорядоченностью последовательности: хранит путь от корня дерева до узла,
+            на котором закончился предыдущий поиск, и начинает следующий поиск не с корня, а с
+            ближайшего предка, поддерево которого может содержать очередной элемент. Поэтому чем
+            плотнее расположены искомые элементы, тем меньше узлов приходится просматривать заново.
+                Возвращает итератор за последним записанным элементом.
+
+                Асимптотика.
+
+            Время: O(min(M log_k(N), M + N / k) log(k)),
+                M — количество искомых элементов.
+                Каждый узел дерева посещается заново не более одного раза.
+            Память: O(log_k(N)).
+         */
+        template <typename InputIterator, typename OutputIterator>
+        OutputIterator
+            contains_sorted
+            (
+                InputIterator first, InputIterator last,
+                OutputIterator result
+            ) const
+        {
+            if (m_values.empty())
+            {
+                return result;
+            }
+
+            std::vector<path_node> path;
+            path.reserve(perfect_tree_height(m_arity, m_values.size()) + 1);
+            path.push_back(path_node{0, m_values.size()});
+
+            for (; first != last; ++first)
+            {
+                const auto & value = *first;
+                while (path.back().upper_bound != m_values.size() &&
+                    not m_compare(value, m_values[path.back().upper_bound]))
+                {
+                    path.pop_back();
+                }
+
+                while (true)
+                {
+                    const auto node = path.back();
+                    const auto node_size = std::min(m_arity - 1, m_values.size() - node.index);
+                    const auto node_begin = m_values.begin() + static_cast<difference_type>(node.index);
+                    const auto node_end = node_begin + static_cast<difference_type>(node_size);
+
+                    const auto search_result = std::lower_bound(node_begin, node_end, value, m_compare);
+                    if (search_result != node_end && not m_compare(value, *search_result))
+                    {
+                        *result = value;
+                        ++result;
+                        break;
+                    }
+
+                    const auto child_number =
+                        static_cast<std::size_t>(std::distance(node_begin, search_result));
+                    const auto child_index = perfect_tree_child_index(m_arity, node.index, child_number);
+                    if (child_index >= m_values.size())
+                    {
+                        break;
+                    }
+
+                    const auto upper_bound =
+                        search_result != node_end
+                            ? node.index + child_number
+                            : node.upper_bound;
+                    path.push_back(path_node{child_index, upper_bound});
+                }
+            }
+
+            return result;
+        }
+
         size_type size () const
         {
             return m_values.size();
@@ -215,6 +372,12 @@ namespace burst
             return m_values.empty();
         }
 
+        //!     Местность дерева.
+        std::size_t arity () const
+        {
+            return m_arity;
+        }
+
         //!     Начало множества.
         /*!
                 Важно, что последовательность [begin(), end()) неупорядочена.
@@ -249,77 +412,113 @@ namespace burst
             return m_values.cend();
         }
 
-    private:
-        const_iterator find_impl (const value_type & value) const
+        //!     Выписать элементы множества в упорядоченном виде.
+        /*!
+                Обходит дерево "слева направо" и записывает его элементы в выходной итератор так,
+            что они оказываются упорядочены относительно отношения порядка множества.
+                Возвращает итератор за последним записанным элементом.
+
+                Асимптотика.
+
+            Время: O(N), N — количество элементов в дереве.
+            Память: O(log_k(N)) — глубина рекурсии при обходе дерева.
+         */
+        template <typename OutputIterator>
+        OutputIterator copy_ordered (OutputIterator result) const
         {
-            std::size_t node_index = 0;
+            return copy_ordered_impl(0, std::move(result));
+        }
 
-            while (node_index < m_values.size())
+    private:
+        template <typename OutputIterator>
+        OutputIterator copy_ordered_impl (std::size_t node_index, OutputIterator result) const
+        {
+            if (node_index < m_values.size())
             {
-                const_iterator node_begin = begin() + static_cast<difference_type>(node_index);
-                const_iterator node_end =
-                    node_begin +
-                    std::min
-                    (
-                        static_cast<difference_type>(m_arity - 1),
-                        std::distance(node_begin, end())
-                    );
-
-                const_iterator search_result =
-                    std::lower_bound(node_begin, node_end, value, m_compare);
-                if (search_result != node_end && not m_compare(value, *search_result))
+                const auto node_size = std::min(m_arity - 1, m_values.size() - node_index);
+                for (std::size_t i = 0; i < node_size; ++i)
                 {
-                    return search_result;
+                    result =
+                        copy_ordered_impl
+                        (
+                            perfect_tree_child_index(m_arity, node_index, i),
+                            std::move(result)
+                        );
+                    *result = m_values[node_index + i];
+                    ++result;
                 }
-                else
-                {
-                    node_index = perfect_tree_child_index
+                result =
+                    copy_ordered_impl
                     (
-                        m_arity,
-                        node_index,
-                        static_cast<std::size_t>(std::distance(node_begin, search_result))
+                        perfect_tree_child_index(m_arity, node_index, node_size),
+                        std::move(result)
                     );
-                }
             }
 
-            return end();
+            return result;
+        }
+
+        const_iterator find_impl (const value_type & value) const
+        {
+            return detail::k_ary_search(begin(), end(), m_arity, value, m_compare);
         }
 
         template <typename RandomAccessRange>
-        void initialize (const RandomAccessRange & range)
+        void initialize (const RandomAccessRange & range, parallel_policy_t policy = par(1))
         {
             if (std::is_sorted(range.begin(), range.end(), m_compare))
             {
-                initialize_trusted(range);
+                initialize_trusted(range, policy);
             }
             else
             {
                 value_container_type buffer(range.begin(), range.end());
-                std::sort(buffer.begin(), buffer.end(), m_compare);
+                sort_buffer(buffer, detail::is_radix_sortable_set<value_type, value_compare>{});
                 buffer.erase
                 (
                     std::unique(buffer.begin(), buffer.end(), not_fn(m_compare)),
                     buffer.end()
                 );
 
-                initialize_trusted(boost::make_iterator_range(buffer));
+                initialize_trusted(boost::make_iterator_range(buffer), policy);
             }
         }
 
+        //!     Упорядочивание буфера сравнением.
+        void sort_buffer (value_container_type & buffer, std::false_type)
+        {
+            std::sort(buffer.begin(), buffer.end(), m_compare);
+        }
+
+        //!     Упорядочивание буфера поразрядной сортировкой.
+        /*!
+                Используется, если элементы множества — целые числа, упорядоченные по возрастанию.
+            В этом случае буфер упорядочивается за линейное время.
+         */
+        void sort_buffer (value_container_type & buffer, std::true_type)
+        {
+            value_container_type radix_buffer(buffer.size());
+            radix_sort(buffer.begin(), buffer.end(), radix_buffer.begin());
+        }
+
         //!     Расстановка элементов по своим местам.
         /*!
-                Обходит дерево по уровням и расставляет по местам в дереве элементы исходной
+                Обходит дерево и расставляет по местам в дереве элементы исходной
             последовательности.
+                Поддеревья заполняют непересекающиеся участки массива, поэтому при параллельном
+            построении верхние уровни дерева заполняются последовательно до тех пор, пока не
+            наберётся достаточно независимых поддеревьев, а затем эти поддеревья распределяются
+            между потоками.
 
                 Асимптотика.
 
             Время: O(N), N — количество элементов в дереве.
-            Память: O(log_k(N) + k),
-                O(log_k(N)) памяти требуется для хранения стека при обходе узлов дерева.
-                O(k) памяти требуется для хранения счётчиков при заполнении одного узла.
+            Память: O(log_k(N)) — глубина рекурсии при обходе дерева.
+                При параллельном построении дополнительно O(P * k), где P — количество потоков,
+                требуется для хранения списка независимых поддеревьев.
          */
         template <typename RandomAccessRange>
-        void initialize_trusted (const RandomAccessRange & range)
+        void initialize_trusted (const RandomAccessRange & range, parallel_policy_t policy = par(1))
         {
             BOOST_ASSERT
             (
@@ -329,60 +528,70 @@ namespace burst
             {
                 m_values.resize(range.size());
 
-                std::stack<k_ary_search_set_branch> branches;
-
-                branches.push({0, size(), perfect_tree_height(m_arity, size()), 0});
-                while (not branches.empty())
+                const auto root =
+                    k_ary_search_set_branch{0, size(), perfect_tree_height(m_arity, size()), 0};
+                if (policy.thread_count <= 1)
                 {
-                    const auto branch = branches.top();
-                    branches.pop();
-
-                    // Количество меньших элементов ветки для каждого элемента текущего узла.
-                    std::vector<std::size_t> counters;
-                    fill_counters(branch, counters);
-
-                    fill_node(branch, counters, range);
-
-                    if (counters[0] > 0)
+                    fill_branch(root, range);
+                }
+                else
+                {
+                    std::vector<k_ary_search_set_branch> branches{root};
+                    while (not branches.empty() && branches.size() < policy.thread_count * 4)
                     {
-                        branches.push
-                        ({
-                            perfect_tree_child_index(m_arity, branch.index, 0),
-                            counters[0],
-                            branch.height - 1,
-                            branch.preceding_elements
-                        });
+                        std::vector<k_ary_search_set_branch> children;
+                        for (const auto & branch: branches)
+                        {
+                            fill_node(branch, range,
+                                [& children] (const auto & child)
+                                {
+                                    children.push_back(child);
+                                });
+                        }
+                        branches.swap(children);
                     }
 
-                    for
-                    (
-                        std::size_t i = 1;
-                        i < counters.size() && (counters[i] - counters[i - 1] - 1) > 0;
-                        ++i
-                    )
-                    {
-                        branches.push
-                        ({
-                            perfect_tree_child_index(m_arity, branch.index, i),
-                            counters[i] - counters[i - 1] - 1,
-                            branch.height - 1,
-                            branch.preceding_elements + counters[i - 1] + 1
+                    detail::parallel_for(policy.thread_count, branches.size(),
+                        [this, & branches, & range] (std::size_t i)
+                        {
+                            fill_branch(branches[i], range);
                         });
-                    }
                 }
             }
         }
 
-        //!     Подсчёт счётчиков для элементов узла.
+        //!     Заполнение ветки целиком.
         /*!
-                Для каждого элемента узла подсчитывает количество элементов в ветке (ветка включает
-            рассматриваемый узел), которые строго меньше этого элемента.
+                Заполняет корневой узел ветки и рекурсивно спускается в каждое из её непустых
+            поддеревьев.
          */
+        template <typename RandomAccessRange>
+        void fill_branch (const k_ary_search_set_branch & branch, const RandomAccessRange & range)
+        {
+            fill_node(branch, range,
+                [this, & range] (const auto & child)
+                {
+                    fill_branch(child, range);
+                });
+        }
+
+        //!     Заполнение узла нужными элементами исходного диапазона.
+        /*!
+                Для каждого элемента узла вычисляется счётчик — количество элементов в ветке (ветка
+            включает рассматриваемый узел), которые строго меньше этого элемента. Счётчик однозначно
+            определяет индекс элемента в исходном диапазоне, поэтому элемент просто копируется.
+                Счётчики вычисляются по формуле, а не хранятся, так что заполнение узла не требует
+            дополнительной памяти.
+                Для каждого непустого поддерева узла вызывается обработчик `visit_child`, которому
+            передаётся ветка, соответствующая этому поддереву.
+         */
+        template <typename RandomAccessRange, typename BranchVisitor>
         void
-            fill_counters
+            fill_node
             (
                 const k_ary_search_set_branch & branch,
-                std::vector<std::size_t> & counters
+                const RandomAccessRange & range,
+                BranchVisitor visit_child
             )
         {
             const std::size_t max_subtree_height = branch.height - 1;
@@ -393,51 +602,52 @@ namespace burst
             const std::size_t elements_in_last_row =
                 branch.size - perfect_tree_size(m_arity, branch.height - 1);
 
-            counters.resize(std::min(m_arity, branch.size + 1));
-            for (std::size_t i = 0; i < counters.size(); ++i)
-            {
-                counters[i] = i + std::min
-                (
-                    (i + 1) * min_subtree_elements + elements_in_last_row,
-                    (i + 1) * max_subtree_elements
-                );
-            }
-            BOOST_ASSERT(counters.back() == branch.size);
-        }
-
-        //!     Заполнение узла нужными элементами исходного диапазона.
-        /*!
-                Для каждого элемента узла известен индекс в исходном диапазоне, по которому лежит
-            нужное значение. Осталось только скопировать его.
-         */
-        template <typename RandomAccessRange>
-        void
-            fill_node
-            (
-                const k_ary_search_set_branch & branch,
-                const std::vector<std::size_t> & counters,
-                const RandomAccessRange & range
-            )
-        {
-            for
-            (
-                std::size_t element_index = 0;
-                element_index < counters.size() - 1;
-                ++element_index
-            )
-            {
-                using difference_type = typename RandomAccessRange::difference_type;
-                const auto index_in_initial_range =
-                    static_cast<difference_type>
+            const auto counter =
+                [min_subtree_elements, max_subtree_elements, elements_in_last_row] (std::size_t i)
+                {
+                    return i + std::min
                     (
-                        branch.preceding_elements + counters[element_index]
+                        (i + 1) * min_subtree_elements + elements_in_last_row,
+                        (i + 1) * max_subtree_elements
                     );
-                m_values[branch.index + element_index] = range[index_in_initial_range];
+                };
+
+            using range_difference_type = typename RandomAccessRange::difference_type;
+            const auto node_size = std::min(m_arity - 1, branch.size);
+
+            std::size_t preceding_in_branch = 0;
+            for (std::size_t element_index = 0; element_index <= node_size; ++element_index)
+            {
+                const auto current_counter = counter(element_index);
+                const auto subtree_size = current_counter - preceding_in_branch;
+
+                if (element_index < node_size)
+                {
+                    const auto index_in_initial_range =
+                        static_cast<range_difference_type>
+                        (
+                            branch.preceding_elements + current_counter
+                        );
+                    m_values[branch.index + element_index] = range[index_in_initial_range];
+                }
+
+                if (subtree_size > 0)
+                {
+                    visit_child(k_ary_search_set_branch{
+                        perfect_tree_child_index(m_arity, branch.index, element_index),
+                        subtree_size,
+                        branch.height - 1,
+                        branch.preceding_elements + preceding_in_branch
+                    });
+                }
+
+                preceding_in_branch = current_counter + 1;
             }
+            BOOST_ASSERT(preceding_in_branch == branch.size + 1);
             BOOST_ASSERT(std::is_sorted
             (
                 m_values.begin() + static_cast<difference_type>(branch.index),
-                m_values.begin() + static_cast<difference_type>(branch.index + counters.size() - 1),
+                m_values.begin() + static_cast<difference_type>(branch.index + node_size),
                 m_compare
             ));
         }
@@ -461,15 +671,25 @@ namespace burst
                 std::size_t child_number
             )
         {
-            return parent_index * arity + (child_number + 1) * (arity - 1);
+            return detail::k_ary_tree_child_index(arity, parent_index, child_number);
         }
 
     private:
-        static const std::size_t default_arity = 33;
+        //!     Узел на пути от корня дерева.
+        /*!
+                Хранит индекс начала узла в массиве и индекс элемента-предка, ограничивающего
+            поддерево узла сверху. Если такого элемента нет, то есть поддерево неограничено сверху,
+            то индекс ограничивающего элемента равен размеру дерева.
+         */
+        struct path_node
+        {
+            std::size_t index;
+            std::size_t upper_bound;
+        };
 
     private:
         value_container_type m_values;
-        const std::size_t m_arity;
+        std::size_t m_arity;
         value_compare m_compare;
     };
 }
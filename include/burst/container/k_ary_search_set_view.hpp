@@ -0,0 +1,266 @@
+#ifndef BURST_CONTAINER_K_ARY_SEARCH_SET_VIEW_HPP
+#define BURST_CONTAINER_K_ARY_SEARCH_SET_VIEW_HPP
+
+#include <burst/container/detail/k_ary_search.hpp>
+#include <burst/container/k_ary_search_set.hpp>
+#include <burst/functional/trivial_write.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Заголовок образа k-местного дерева поиска.
+        /*!
+                Образ состоит из заголовка и следующего сразу за ним массива элементов дерева в том
+            же порядке, в котором они лежат в памяти множества.
+                Числа записываются в порядке байтов той машины, на которой образ создан. Поле
+            `byte_order` позволяет обнаружить попытку прочитать образ на машине с другим порядком
+            байтов.
+                Размер заголовка выбран так, чтобы массив элементов был выровнен по границе строки
+            кэша, если сам образ выровнен.
+         */
+        struct k_ary_search_set_image_header
+        {
+            char signature[8];
+            std::uint32_t version;
+            std::uint32_t byte_order;
+            std::uint64_t value_size;
+            std::uint64_t arity;
+            std::uint64_t size;
+            char reserved[24];
+        };
+        static_assert(sizeof(k_ary_search_set_image_header) == 64, "");
+
+        constexpr const char k_ary_search_set_image_signature[8] =
+            {'B', 'U', 'R', 'S', 'T', 'K', 'A', 'S'};
+        constexpr const std::uint32_t k_ary_search_set_image_version = 1;
+        constexpr const std::uint32_t k_ary_search_set_image_byte_order = 0x01020304;
+    } // namespace detail
+
+    //!     Записать образ k-местного дерева поиска в поток.
+    /*!
+            Записывает заголовок, а за ним — элементы множества ровно в том виде, в каком они
+        хранятся в памяти. Поэтому образ можно отобразить в память и искать в нём без какой-либо
+        предобработки (см. `k_ary_search_set_view`).
+            Элементы множества должны быть тривиально копируемыми.
+     */
+    template <typename Value, typename Compare>
+    std::ostream &
+        write_k_ary_search_set
+        (
+            std::ostream & stream,
+            const k_ary_search_set<Value, Compare> & set
+        )
+    {
+        static_assert(std::is_trivially_copyable<Value>::value,
+            "Образ можно создать только для тривиально копируемых элементов.");
+
+        auto header = detail::k_ary_search_set_image_header{};
+        std::memcpy(header.signature, detail::k_ary_search_set_image_signature,
+            sizeof(header.signature));
+        header.version = detail::k_ary_search_set_image_version;
+        header.byte_order = detail::k_ary_search_set_image_byte_order;
+        header.value_size = sizeof(Value);
+        header.arity = set.arity();
+        header.size = set.size();
+        trivial_write(stream, header);
+
+        if (not set.empty())
+        {
+            stream.write
+            (
+                reinterpret_cast<const char *>(std::addressof(*set.begin())),
+                static_cast<std::streamsize>(set.size() * sizeof(Value))
+            );
+        }
+
+        return stream;
+    }
+
+    //!     Представление k-местного дерева поиска поверх готового образа.
+    /*!
+            Не владеет памятью и ничего не копирует: ищет прямо в массиве элементов, лежащем в
+        образе, созданном функцией `write_k_ary_search_set`. Образ может находиться в любой
+        памяти, например, в файле, отображённом в память, что позволяет нескольким процессам
+        пользоваться одним и тем же деревом, не строя его заново.
+            Память образа должна существовать всё время жизни представления и быть выровнена так,
+        чтобы массив элементов был выровнен для типа `Value`.
+
+        \tparam Value
+            Тип элементов. Должен быть тривиально копируемым и совпадать с типом элементов
+            множества, из которого создан образ.
+        \tparam Compare
+            Отношение порядка. Должно совпадать с отношением порядка множества, из которого
+            создан образ.
+     */
+    template <typename Value, typename Compare = std::less<>>
+    class k_ary_search_set_view
+    {
+        static_assert(std::is_trivially_copyable<Value>::value,
+            "Представление возможно только для тривиально копируемых элементов.");
+
+    public:
+        using value_type = Value;
+        using value_compare = Compare;
+        using const_iterator = const value_type *;
+        using iterator = const_iterator;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+    public:
+        //!     Создание представления по образу.
+        /*!
+                Принимает указатель на начало образа и его размер в байтах.
+                Проверяет заголовок образа, и если образ повреждён, создан для другого типа
+            элементов или на машине с другим порядком байтов, то бросает исключение
+            `std::invalid_argument`.
+
+                Асимптотика.
+
+            Время: O(1).
+            Память: O(1).
+         */
+        k_ary_search_set_view
+                (
+                    const void * image,
+                    std::size_t image_size,
+                    const value_compare & compare = value_compare()
+                ):
+            m_begin(nullptr),
+            m_end(nullptr),
+            m_arity(0),
+            m_compare(compare)
+        {
+            auto header = detail::k_ary_search_set_image_header{};
+            if (image_size < sizeof(header))
+            {
+                throw std::invalid_argument("Образ k-местного дерева меньше своего заголовка.");
+            }
+            std::memcpy(&header, image, sizeof(header));
+
+            if (std::memcmp(header.signature, detail::k_ary_search_set_image_signature,
+                sizeof(header.signature)) != 0)
+            {
+                throw std::invalid_argument("Неверная сигнатура образа k-местного дерева.");
+            }
+            if (header.version != detail::k_ary_search_set_image_version)
+            {
+                throw std::invalid_argument("Неподдерживаемая версия образа k-местного дерева.");
+            }
+            if (header.byte_order != detail::k_ary_search_set_image_byte_order)
+            {
+                throw std::invalid_argument("Образ k-местного дерева создан с другим порядком байтов.");
+            }
+            if (header.value_size != sizeof(value_type))
+            {
+                throw std::invalid_argument("Образ k-местного дерева создан для другого типа элементов.");
+            }
+            if (header.size > 0 && header.arity < 2)
+            {
+                throw std::invalid_argument("Арность k-местного дерева должна быть не меньше двух.");
+            }
+            // Индекс потомка при поиске не превосходит arity * (size + arity), и это выражение
+            // не должно переполняться.
+            const auto max_index = std::uint64_t{std::numeric_limits<std::size_t>::max()};
+            if (header.arity > max_index - header.size ||
+                (header.arity > 0 && header.arity > max_index / (header.size + header.arity)))
+            {
+                throw std::invalid_argument("Арность k-местного дерева слишком велика.");
+            }
+            if ((image_size - sizeof(header)) / sizeof(value_type) < header.size)
+            {
+                throw std::invalid_argument("Образ k-местного дерева обрезан.");
+            }
+
+            const auto values = static_cast<const char *>(image) + sizeof(header);
+            if (reinterpret_cast<std::uintptr_t>(values) % alignof(value_type) != 0)
+            {
+                throw std::invalid_argument("Элементы образа k-местного дерева не выровнены.");
+            }
+
+            m_begin = reinterpret_cast<const_iterator>(values);
+            m_end = m_begin + header.size;
+            m_arity = static_cast<std::size_t>(header.arity);
+        }
+
+        k_ary_search_set_view ():
+            m_begin(nullptr),
+            m_end(nullptr),
+            m_arity(0),
+            m_compare{}
+        {
+        }
+
+    public:
+        //!     Поиск элемента.
+        /*!
+                Если искомый элемент есть в дереве, то возвращается указатель на него. Если нет,
+            то возвращается end().
+
+                Асимптотика.
+
+            Время: O(log_k(N)).
+            Память: O(1).
+         */
+        const_iterator find (const value_type & value) const
+        {
+            return detail::k_ary_search(m_begin, m_end, m_arity, value, m_compare);
+        }
+
+        size_type size () const
+        {
+            return static_cast<size_type>(m_end - m_begin);
+        }
+
+        bool empty () const
+        {
+            return m_begin == m_end;
+        }
+
+        std::size_t arity () const
+        {
+            return m_arity;
+        }
+
+        //!     Начало множества.
+        /*!
+                Как и в `k_ary_search_set`, последовательность [begin(), end()) неупорядочена.
+         */
+        const_iterator begin () const
+        {
+            return m_begin;
+        }
+
+        const_iterator end () const
+        {
+            return m_end;
+        }
+
+        const_iterator cbegin () const
+        {
+            return m_begin;
+        }
+
+        const_iterator cend () const
+        {
+            return m_end;
+        }
+
+    private:
+        const_iterator m_begin;
+        const_iterator m_end;
+        std::size_t m_arity;
+        value_compare m_compare;
+    };
+} // namespace burst
+
+#endif // BURST_CONTAINER_K_ARY_SEARCH_SET_VIEW_HPP
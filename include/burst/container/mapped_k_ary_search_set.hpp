@@ -0,0 +1,202 @@
+#ifndef BURST_CONTAINER_MAPPED_K_ARY_SEARCH_SET_HPP
+#define BURST_CONTAINER_MAPPED_K_ARY_SEARCH_SET_HPP
+
+#include <burst/container/k_ary_search_set_view.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace burst
+{
+    //!     k-местное дерево поиска, отображённое в память из файла.
+    /*!
+            Открывает файл с образом дерева, созданным функцией `write_k_ary_search_set`, и
+        отображает его в память только для чтения. Страницы файла разделяются между всеми
+        процессами, которые отобразили тот же файл, поэтому каждый из процессов не тратит ни
+        времени на построение дерева, ни памяти на собственную копию.
+            Поиск ведётся через `k_ary_search_set_view` прямо в отображённой памяти.
+            Реализация использует интерфейс POSIX.
+
+        \tparam Value
+            Тип элементов. Должен быть тривиально копируемым и совпадать с типом элементов
+            множества, из которого создан образ.
+        \tparam Compare
+            Отношение порядка. Должно совпадать с отношением порядка множества, из которого
+            создан образ.
+     */
+    template <typename Value, typename Compare = std::less<>>
+    class mapped_k_ary_search_set
+    {
+    public:
+        using view_type = k_ary_search_set_view<Value, Compare>;
+        using value_type = typename view_type::value_type;
+        using value_compare = typename view_type::value_compare;
+        using const_iterator = typename view_type::const_iterator;
+        using iterator = typename view_type::iterator;
+        using size_type = typename view_type::size_type;
+
+    public:
+        //!     Отобразить в память файл с образом дерева.
+        /*!
+                Если файл не удалось открыть или отобразить в память, то бросает исключение
+            `std::system_error`. Если образ повреждён или не соответствует типу элементов, то
+            бросает `std::invalid_argument`.
+         */
+        explicit mapped_k_ary_search_set
+                (
+                    const std::string & path,
+                    const value_compare & compare = value_compare()
+                ):
+            m_mapping(nullptr),
+            m_mapping_size(0),
+            m_view{}
+        {
+            const auto file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (file == -1)
+            {
+                throw std::system_error(errno, std::generic_category(),
+                    "Не удалось открыть файл " + path);
+            }
+
+            struct stat status;
+            if (::fstat(file, &status) == -1)
+            {
+                const auto error = errno;
+                ::close(file);
+                throw std::system_error(error, std::generic_category(),
+                    "Не удалось узнать размер файла " + path);
+            }
+            const auto size = static_cast<std::size_t>(status.st_size);
+
+            if (size > 0)
+            {
+                auto mapping = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+                if (mapping == MAP_FAILED)
+                {
+                    const auto error = errno;
+                    ::close(file);
+                    throw std::system_error(error, std::generic_category(),
+                        "Не удалось отобразить в память файл " + path);
+                }
+                m_mapping = mapping;
+                m_mapping_size = size;
+            }
+            ::close(file);
+
+            try
+            {
+                m_view = view_type(m_mapping, m_mapping_size, compare);
+            }
+            catch (...)
+            {
+                unmap();
+                throw;
+            }
+        }
+
+        mapped_k_ary_search_set (const mapped_k_ary_search_set &) = delete;
+        mapped_k_ary_search_set & operator = (const mapped_k_ary_search_set &) = delete;
+
+        mapped_k_ary_search_set (mapped_k_ary_search_set && that):
+            m_mapping(that.m_mapping),
+            m_mapping_size(that.m_mapping_size),
+            m_view(that.m_view)
+        {
+            that.m_mapping = nullptr;
+            that.m_mapping_size = 0;
+            that.m_view = view_type{};
+        }
+
+        mapped_k_ary_search_set & operator = (mapped_k_ary_search_set && that)
+        {
+            if (this != &that)
+            {
+                unmap();
+                std::swap(m_mapping, that.m_mapping);
+                std::swap(m_mapping_size, that.m_mapping_size);
+                std::swap(m_view, that.m_view);
+            }
+
+            return *this;
+        }
+
+        ~mapped_k_ary_search_set ()
+        {
+            unmap();
+        }
+
+    public:
+        const_iterator find (const value_type & value) const
+        {
+            return m_view.find(value);
+        }
+
+        size_type size () const
+        {
+            return m_view.size();
+        }
+
+        bool empty () const
+        {
+            return m_view.empty();
+        }
+
+        std::size_t arity () const
+        {
+            return m_view.arity();
+        }
+
+        const_iterator begin () const
+        {
+            return m_view.begin();
+        }
+
+        const_iterator end () const
+        {
+            return m_view.end();
+        }
+
+        const_iterator cbegin () const
+        {
+            return m_view.cbegin();
+        }
+
+        const_iterator cend () const
+        {
+            return m_view.cend();
+        }
+
+        const view_type & view () const
+        {
+            return m_view;
+        }
+
+    private:
+        void unmap ()
+        {
+            if (m_mapping != nullptr)
+            {
+                ::munmap(m_mapping, m_mapping_size);
+                m_mapping = nullptr;
+                m_mapping_size = 0;
+                m_view = view_type{};
+            }
+        }
+
+    private:
+        void * m_mapping;
+        std::size_t m_mapping_size;
+        view_type m_view;
+    };
+} // namespace burst
+
+#endif // BURST_CONTAINER_MAPPED_K_ARY_SEARCH_SET_HPP
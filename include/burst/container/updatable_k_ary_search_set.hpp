@@ -0,0 +1,306 @@
+#ifndef BURST_CONTAINER_UPDATABLE_K_ARY_SEARCH_SET_HPP
+#define BURST_CONTAINER_UPDATABLE_K_ARY_SEARCH_SET_HPP
+
+#include <burst/container/k_ary_search_set.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+#include <burst/range/difference.hpp>
+#include <burst/range/make_range_vector.hpp>
+#include <burst/range/merge.hpp>
+
+#include <boost/range/algorithm/copy.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace burst
+{
+    //!     Изменяемое множество на основе k-местного дерева поиска.
+    /*!
+            Само k-местное дерево поиска неизменяемо: чтобы добавить в него элемент или удалить из
+        него элемент, приходится перестраивать дерево целиком.
+            Данное множество позволяет вставлять и удалять элементы, не перестраивая дерево при
+        каждом изменении. Для этого изменения накапливаются в двух небольших упорядоченных буферах:
+        буфере вставленных элементов, которых нет в дереве, и буфере удалённых элементов
+        ("надгробий"), которые в дереве есть. При поиске сначала просматриваются буферы, а затем
+        дерево.
+            Когда суммарный размер буферов превышает заданный порог, дерево перестраивается:
+        упорядоченное содержимое дерева сливается с буферами, и из результата строится новое
+        дерево, а буферы опустошаются.
+
+        \tparam Value
+            Тип данных, хранящихся в множестве.
+        \tparam Compare
+            Отношение порядка, по которому элементы выстроены в дереве.
+
+            Асимптотика.
+
+        Поиск: O(log_k(N) + log(B)),
+            N — количество элементов в дереве,
+            B — суммарный размер буферов.
+        Вставка и удаление: O(log_k(N) + B) плюс амортизированная стоимость перестроения.
+        Перестроение: O(N + B).
+     */
+    template <typename Value, typename Compare = std::less<>>
+    class updatable_k_ary_search_set
+    {
+    private:
+        using base_set_type = k_ary_search_set<Value, Compare>;
+        using buffer_type = std::vector<Value>;
+
+    public:
+        using value_type = Value;
+        using value_compare = Compare;
+        using size_type = std::size_t;
+
+    public:
+        //!     Максимальный суммарный размер буферов по-умолчанию.
+        static const size_type default_max_pending = 4096;
+
+    public:
+        //!     Создание множества из набора, заданного итераторами.
+        /*!
+                Принимает два итератора, которые задают исходный набор элементов, местность
+            дерева, максимальный суммарный размер буферов изменений, после превышения которого
+            дерево перестраивается, и отношение порядка на элементах.
+         */
+        template <typename RandomAccessIterator>
+        updatable_k_ary_search_set
+                (
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    std::size_t arity = base_set_type::default_arity,
+                    size_type max_pending = default_max_pending,
+                    const value_compare & compare = value_compare()
+                ):
+            m_base(first, last, arity, compare),
+            m_arity(arity),
+            m_max_pending(max_pending),
+            m_compare(compare)
+        {
+        }
+
+        //!     Создание множества из упорядоченного набора, заданного итераторами.
+        /*!
+                Аналогично предыдущему, но принимает метку, обозначающую, что входной набор уже
+            упорядочен, и элементы в нём уникальны.
+         */
+        template <typename RandomAccessIterator>
+        updatable_k_ary_search_set
+                (
+                    container::unique_ordered_tag_t,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    std::size_t arity = base_set_type::default_arity,
+                    size_type max_pending = default_max_pending,
+                    const value_compare & compare = value_compare()
+                ):
+            m_base(container::unique_ordered_tag, first, last, arity, compare),
+            m_arity(arity),
+            m_max_pending(max_pending),
+            m_compare(compare)
+        {
+        }
+
+        updatable_k_ary_search_set
+                (
+                    std::initializer_list<value_type> values,
+                    std::size_t arity = base_set_type::default_arity,
+                    size_type max_pending = default_max_pending,
+                    const value_compare & compare = value_compare()
+                ):
+            updatable_k_ary_search_set(values.begin(), values.end(), arity, max_pending, compare)
+        {
+        }
+
+        updatable_k_ary_search_set ():
+            m_base{},
+            m_arity(base_set_type::default_arity),
+            m_max_pending(default_max_pending),
+            m_compare{}
+        {
+        }
+
+    public:
+        //!     Проверка наличия элемента в множестве.
+        /*!
+                Элемент есть в множестве, если он есть в буфере вставленных элементов, либо если
+            он есть в дереве и при этом не был удалён.
+         */
+        bool contains (const value_type & value) const
+        {
+            if (buffer_contains(m_inserted, value))
+            {
+                return true;
+            }
+            else
+            {
+                return m_base.find(value) != m_base.end() && not buffer_contains(m_erased, value);
+            }
+        }
+
+        //!     Вставка элемента.
+        /*!
+                Возвращает `true`, если элемент был вставлен, и `false`, если он уже был в
+            множестве.
+                Если вставка привела к переполнению буферов, то дерево перестраивается.
+         */
+        bool insert (const value_type & value)
+        {
+            if (m_base.find(value) != m_base.end())
+            {
+                // Элемент есть в дереве. Вставка возможна только если он был удалён.
+                if (not buffer_erase(m_erased, value))
+                {
+                    return false;
+                }
+            }
+            else if (not buffer_insert(m_inserted, value))
+            {
+                return false;
+            }
+
+            rebuild_if_needed();
+            return true;
+        }
+
+        //!     Удаление элемента.
+        /*!
+                Возвращает количество удалённых элементов, то есть единицу, если элемент был в
+            множестве, и ноль в противном случае.
+                Если удаление привело к переполнению буферов, то дерево перестраивается.
+         */
+        size_type erase (const value_type & value)
+        {
+            if (not buffer_erase(m_inserted, value))
+            {
+                if (m_base.find(value) == m_base.end() || not buffer_insert(m_erased, value))
+                {
+                    return 0;
+                }
+            }
+
+            rebuild_if_needed();
+            return 1;
+        }
+
+        size_type size () const
+        {
+            return m_base.size() - m_erased.size() + m_inserted.size();
+        }
+
+        bool empty () const
+        {
+            return size() == 0;
+        }
+
+        //!     Количество накопленных и ещё не применённых к дереву изменений.
+        size_type pending () const
+        {
+            return m_inserted.size() + m_erased.size();
+        }
+
+        //!     Перестроение дерева.
+        /*!
+                Упорядоченное содержимое дерева без удалённых элементов сливается с буфером
+            вставленных элементов, и из результата строится новое дерево. Буферы опустошаются.
+
+                Асимптотика.
+
+            Время: O(N + B).
+            Память: O(N + B).
+         */
+        void rebuild ()
+        {
+            if (pending() == 0)
+            {
+                return;
+            }
+
+            buffer_type ordered;
+            ordered.reserve(m_base.size());
+            m_base.copy_ordered(std::back_inserter(ordered));
+
+            buffer_type survivors;
+            survivors.reserve(m_base.size() - m_erased.size());
+            boost::copy(difference(ordered, m_erased, m_compare), std::back_inserter(survivors));
+
+            buffer_type values;
+            values.reserve(size());
+            auto ranges = make_range_vector(survivors, m_inserted);
+            boost::copy(merge(ranges, m_compare), std::back_inserter(values));
+
+            m_base =
+                base_set_type
+                (
+                    container::unique_ordered_tag,
+                    values.begin(), values.end(),
+                    m_arity,
+                    m_compare
+                );
+            m_inserted.clear();
+            m_erased.clear();
+        }
+
+    private:
+        void rebuild_if_needed ()
+        {
+            if (pending() > m_max_pending)
+            {
+                rebuild();
+            }
+        }
+
+        bool buffer_contains (const buffer_type & buffer, const value_type & value) const
+        {
+            auto position = std::lower_bound(buffer.begin(), buffer.end(), value, m_compare);
+            return position != buffer.end() && not m_compare(value, *position);
+        }
+
+        //!     Вставить элемент в упорядоченный буфер.
+        /*!
+                Возвращает `true`, если элемента в буфере не было, и он был вставлен.
+         */
+        bool buffer_insert (buffer_type & buffer, const value_type & value)
+        {
+            auto position = std::lower_bound(buffer.begin(), buffer.end(), value, m_compare);
+            if (position != buffer.end() && not m_compare(value, *position))
+            {
+                return false;
+            }
+
+            buffer.insert(position, value);
+            return true;
+        }
+
+        //!     Удалить элемент из упорядоченного буфера.
+        /*!
+                Возвращает `true`, если элемент был в буфере, и он был удалён.
+         */
+        bool buffer_erase (buffer_type & buffer, const value_type & value)
+        {
+            auto position = std::lower_bound(buffer.begin(), buffer.end(), value, m_compare);
+            if (position == buffer.end() || m_compare(value, *position))
+            {
+                return false;
+            }
+
+            buffer.erase(position);
+            return true;
+        }
+
+    private:
+        base_set_type m_base;
+        buffer_type m_inserted; // Упорядоченные элементы, которых нет в дереве.
+        buffer_type m_erased; // Упорядоченные элементы дерева, которые были удалены.
+        std::size_t m_arity;
+        size_type m_max_pending;
+        value_compare m_compare;
+    };
+}
+
+#endif // BURST_CONTAINER_UPDATABLE_K_ARY_SEARCH_SET_HPP
@@ -0,0 +1,93 @@
+#ifndef BURST_EXECUTION_DETAIL_PARALLEL_FOR_HPP
+#define BURST_EXECUTION_DETAIL_PARALLEL_FOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Параллельно выполнить набор независимых задач.
+        /*!
+                Вызывает `task(i)` для каждого `i` из `[0, task_count)`. Задачи разбираются
+            потоками по одной из общего атомарного счётчика, поэтому задачи разной длительности
+            распределяются между потоками равномерно.
+                Вызывающий поток тоже выполняет задачи, так что дополнительно запускается не более
+            `thread_count - 1` потоков. Если запустить поток не удалось, то оставшиеся задачи
+            выполняются уже запущенными потоками.
+                Если какая-либо из задач бросила исключение, то новые задачи больше не берутся, а
+            после завершения всех потоков первое из брошенных исключений пробрасывается наружу.
+         */
+        template <typename Task>
+        void parallel_for (std::size_t thread_count, std::size_t task_count, Task task)
+        {
+            thread_count = std::min(thread_count, task_count);
+            if (thread_count <= 1)
+            {
+                for (std::size_t i = 0; i < task_count; ++i)
+                {
+                    task(i);
+                }
+                return;
+            }
+
+            std::atomic<std::size_t> next_task{0};
+            std::exception_ptr error;
+            std::mutex error_mutex;
+
+            auto worker =
+                [& task, & next_task, & error, & error_mutex, task_count]
+                {
+                    try
+                    {
+                        for (auto i = next_task++; i < task_count; i = next_task++)
+                        {
+                            task(i);
+                        }
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(error_mutex);
+                        if (not error)
+                        {
+                            error = std::current_exception();
+                        }
+                        next_task = task_count;
+                    }
+                };
+
+            std::vector<std::thread> threads;
+            threads.reserve(thread_count - 1);
+            try
+            {
+                while (threads.size() < thread_count - 1)
+                {
+                    threads.emplace_back(worker);
+                }
+            }
+            catch (std::system_error &)
+            {
+            }
+
+            worker();
+            for (auto & thread: threads)
+            {
+                thread.join();
+            }
+
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_EXECUTION_DETAIL_PARALLEL_FOR_HPP
@@ -0,0 +1,27 @@
+#ifndef BURST_EXECUTION_PARALLEL_POLICY_HPP
+#define BURST_EXECUTION_PARALLEL_POLICY_HPP
+
+#include <cstddef>
+
+namespace burst
+{
+    //!     Политика параллельного исполнения.
+    /*!
+            Передаётся первым аргументом в алгоритмы и конструкторы, которые умеют распределять
+        работу между несколькими потоками, и задаёт желаемое количество потоков.
+            Количество потоков, равное нулю или единице, означает последовательное исполнение в
+        вызывающем потоке.
+     */
+    struct parallel_policy_t
+    {
+        std::size_t thread_count;
+    };
+
+    //!     Создать политику параллельного исполнения на заданном количестве потоков.
+    constexpr parallel_policy_t par (std::size_t thread_count)
+    {
+        return parallel_policy_t{thread_count};
+    }
+} // namespace burst
+
+#endif // BURST_EXECUTION_PARALLEL_POLICY_HPP
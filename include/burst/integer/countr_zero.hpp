@@ -0,0 +1,43 @@
+#ifndef BURST_INTEGER_COUNTR_ZERO_HPP
+#define BURST_INTEGER_COUNTR_ZERO_HPP
+
+#include <burst/concept/integer.hpp>
+
+#include <limits>
+#include <type_traits>
+
+namespace burst
+{
+    //!     Количество нулевых бит в числе, идущих подряд начиная с младшего
+    /*!
+            Принимает беззнаковое целое число не шире `unsigned long long`.
+            Для нуля возвращает разрядность типа.
+            Если компилятор предоставляет встроенную функцию, то используется она.
+     */
+    template <typename I>
+    constexpr int countr_zero (Integer<I> value)
+    {
+        static_assert(std::is_unsigned<I>::value, "Число должно быть беззнаковым.");
+        static_assert(std::numeric_limits<I>::digits <= std::numeric_limits<unsigned long long>::digits,
+            "Число не должно быть шире unsigned long long.");
+
+        if (value == 0)
+        {
+            return std::numeric_limits<I>::digits;
+        }
+
+#if defined(__GNUC__)
+        return __builtin_ctzll(value);
+#else
+        auto count = 0;
+        while ((value & 1u) == 0)
+        {
+            value >>= 1;
+            ++count;
+        }
+        return count;
+#endif
+    }
+} // namespace burst
+
+#endif // BURST_INTEGER_COUNTR_ZERO_HPP
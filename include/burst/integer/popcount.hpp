@@ -0,0 +1,39 @@
+#ifndef BURST_INTEGER_POPCOUNT_HPP
+#define BURST_INTEGER_POPCOUNT_HPP
+
+#include <burst/concept/integer.hpp>
+
+#include <limits>
+#include <type_traits>
+
+namespace burst
+{
+    //!     Количество единичных бит в числе
+    /*!
+            Принимает беззнаковое целое число не шире `unsigned long long`.
+            Если компилятор предоставляет встроенную функцию подсчёта единиц, то используется
+        она: на большинстве процессоров это одна инструкция. Иначе единицы подсчитываются
+        по одной.
+     */
+    template <typename I>
+    constexpr int popcount (Integer<I> value)
+    {
+        static_assert(std::is_unsigned<I>::value, "Число должно быть беззнаковым.");
+        static_assert(std::numeric_limits<I>::digits <= std::numeric_limits<unsigned long long>::digits,
+            "Число не должно быть шире unsigned long long.");
+
+#if defined(__GNUC__)
+        return __builtin_popcountll(value);
+#else
+        auto count = 0;
+        while (value != 0)
+        {
+            value &= static_cast<I>(value - 1);
+            ++count;
+        }
+        return count;
+#endif
+    }
+} // namespace burst
+
+#endif // BURST_INTEGER_POPCOUNT_HPP
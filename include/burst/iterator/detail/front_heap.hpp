@@ -0,0 +1,235 @@
+#ifndef BURST_ITERATOR_DETAIL_FRONT_HEAP_HPP
+#define BURST_ITERATOR_DETAIL_FRONT_HEAP_HPP
+
+#include <boost/range/value_type.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Первые элементы диапазонов, закэшированные в плотном массиве.
+        /*!
+                Сами диапазоны лежат во внешнем диапазоне, а их первые элементы копируются в
+            отдельный массив в том же порядке. Пирамида, построенная над такой парой массивов,
+            сравнивает только элементы плотного массива и не обращается к памяти диапазонов, а
+            переставляет диапазоны и их первые элементы одновременно.
+                Первый элемент диапазона нужно обновлять (`refresh`) после каждого его продвижения.
+         */
+        template <typename RandomAccessIterator, typename Value>
+        class cached_fronts
+        {
+        private:
+            using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+
+        public:
+            cached_fronts () = default;
+
+            cached_fronts (RandomAccessIterator ranges, std::size_t count):
+                m_ranges(std::move(ranges)),
+                m_fronts()
+            {
+                m_fronts.reserve(count);
+                for (std::size_t index = 0; index < count; ++index)
+                {
+                    m_fronts.push_back(range(index).front());
+                }
+            }
+
+            const Value & key (std::size_t index) const
+            {
+                return m_fronts[index];
+            }
+
+            void refresh (std::size_t index)
+            {
+                m_fronts[index] = range(index).front();
+            }
+
+            void swap (std::size_t left, std::size_t right)
+            {
+                std::iter_swap(std::next(m_ranges, offset(left)), std::next(m_ranges, offset(right)));
+                std::swap(m_fronts[left], m_fronts[right]);
+            }
+
+        private:
+            static difference_type offset (std::size_t index)
+            {
+                return static_cast<difference_type>(index);
+            }
+
+            decltype(auto) range (std::size_t index) const
+            {
+                return m_ranges[offset(index)];
+            }
+
+        private:
+            RandomAccessIterator m_ranges;
+            std::vector<Value> m_fronts;
+        };
+
+        //!     Первые элементы диапазонов без кэширования.
+        /*!
+                Используется, когда элементы диапазонов нельзя дёшево копировать: каждое сравнение
+            обращается к самому диапазону.
+         */
+        template <typename RandomAccessIterator>
+        class uncached_fronts
+        {
+        private:
+            using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+
+        public:
+            uncached_fronts () = default;
+
+            uncached_fronts (RandomAccessIterator ranges, std::size_t):
+                m_ranges(std::move(ranges))
+            {
+            }
+
+            decltype(auto) key (std::size_t index) const
+            {
+                return m_ranges[static_cast<difference_type>(index)].front();
+            }
+
+            void refresh (std::size_t)
+            {
+            }
+
+            void swap (std::size_t left, std::size_t right)
+            {
+                std::iter_swap
+                (
+                    std::next(m_ranges, static_cast<difference_type>(left)),
+                    std::next(m_ranges, static_cast<difference_type>(right))
+                );
+            }
+
+        private:
+            RandomAccessIterator m_ranges;
+        };
+
+        //!     Способ хранения первых элементов диапазонов для пирамиды.
+        /*!
+                Первые элементы кэшируются, если они тривиально копируемы.
+         */
+        template <typename RandomAccessIterator>
+        using front_cache_t =
+            std::conditional_t
+            <
+                std::is_trivially_copyable
+                <
+                    typename boost::range_value
+                    <
+                        typename std::iterator_traits<RandomAccessIterator>::value_type
+                    >
+                    ::type
+                >
+                ::value,
+                cached_fronts
+                <
+                    RandomAccessIterator,
+                    typename boost::range_value
+                    <
+                        typename std::iterator_traits<RandomAccessIterator>::value_type
+                    >
+                    ::type
+                >,
+                uncached_fronts<RandomAccessIterator>
+            >;
+
+        //!     Просеять элемент пирамиды вниз.
+        /*!
+                Пирамида — первые `size` диапазонов, упорядоченных так, что первый элемент каждого
+            из них не меньше первого элемента его родителя. Сравниваются ключи из `fronts`.
+                Возвращает новое положение просеиваемого элемента.
+         */
+        template <typename Fronts, typename Compare>
+        std::size_t sift_front_heap_down (Fronts & fronts, std::size_t position, std::size_t size, Compare compare)
+        {
+            while (true)
+            {
+                auto child = 2 * position + 1;
+                if (child >= size)
+                {
+                    break;
+                }
+                if (child + 1 < size && compare(fronts.key(child + 1), fronts.key(child)))
+                {
+                    ++child;
+                }
+                if (not compare(fronts.key(child), fronts.key(position)))
+                {
+                    break;
+                }
+
+                fronts.swap(position, child);
+                position = child;
+            }
+
+            return position;
+        }
+
+        template <typename Fronts, typename Compare>
+        void make_front_heap (Fronts & fronts, std::size_t size, Compare compare)
+        {
+            for (auto position = size / 2; position > 0; --position)
+            {
+                sift_front_heap_down(fronts, position - 1, size, compare);
+            }
+        }
+
+        //!     Перенести вершину пирамиды из `size` элементов в её конец.
+        template <typename Fronts, typename Compare>
+        void pop_front_heap (Fronts & fronts, std::size_t size, Compare compare)
+        {
+            fronts.swap(0, size - 1);
+            sift_front_heap_down(fronts, 0, size - 1, compare);
+        }
+
+        //!     Добавить в пирамиду элемент, стоящий сразу за ней.
+        /*!
+                После вызова пирамида состоит из `size` элементов.
+         */
+        template <typename Fronts, typename Compare>
+        void push_front_heap (Fronts & fronts, std::size_t size, Compare compare)
+        {
+            auto position = size - 1;
+            while (position > 0)
+            {
+                const auto parent = (position - 1) / 2;
+                if (not compare(fronts.key(position), fronts.key(parent)))
+                {
+                    break;
+                }
+
+                fronts.swap(position, parent);
+                position = parent;
+            }
+        }
+
+        //!     Номер второго по старшинству элемента пирамиды.
+        /*!
+                Если в пирамиде меньше двух элементов, то возвращается `size`.
+         */
+        template <typename Fronts, typename Compare>
+        std::size_t front_heap_runner_up (const Fronts & fronts, std::size_t size, Compare compare)
+        {
+            if (size < 2)
+            {
+                return size;
+            }
+
+            const auto last_child = std::min(size - 1, std::size_t{2});
+            return compare(fronts.key(last_child), fronts.key(1)) ? last_child : 1;
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_ITERATOR_DETAIL_FRONT_HEAP_HPP
@@ -0,0 +1,190 @@
+#ifndef BURST_ITERATOR_DETAIL_INTERSECT_BLOCKS_HPP
+#define BURST_ITERATOR_DETAIL_INTERSECT_BLOCKS_HPP
+
+#include <burst/range/detail/skip_to_lower_bound.hpp>
+#include <burst/range/skip_policy.hpp>
+
+#include <boost/range/iterator.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Можно ли пересекать диапазоны поблочно.
+        /*!
+                Можно, если диапазоны — диапазоны произвольного доступа, их элементы — целые числа,
+            а отношение порядка — стандартное "меньше". Тогда равенство элементов можно проверять
+            оператором `==` без ветвлений, и такие проверки компилятор умеет векторизовать.
+         */
+        template <typename Range, typename Compare>
+        struct is_block_intersectable:
+            std::integral_constant
+            <
+                bool,
+                std::is_base_of
+                <
+                    std::random_access_iterator_tag,
+                    typename std::iterator_traits
+                    <
+                        typename boost::range_iterator<Range>::type
+                    >
+                    ::iterator_category
+                >
+                ::value &&
+                std::is_integral<typename boost::range_value<Range>::type>::value &&
+                (
+                    std::is_same<Compare, std::less<>>::value ||
+                    std::is_same<Compare, std::less<typename boost::range_value<Range>::type>>::value
+                )
+            >
+        {
+        };
+
+        //!     Размер блока при поблочном пересечении.
+        constexpr const std::size_t intersect_block_size = 8;
+
+        //!     Сколько шагов обычного пересечения делается перед поблочным пропуском.
+        /*!
+                Если общий элемент близко, то обычное пересечение находит его за несколько шагов,
+            а поблочное сравнение только добавило бы к каждому шагу 64 лишних сравнения.
+         */
+        constexpr const std::size_t intersect_scalar_steps = 8;
+
+        //!     Есть ли у двух блоков хотя бы один общий элемент.
+        /*!
+                Сравнивает каждый элемент одного блока с каждым элементом другого. Все 8×8
+            сравнений выполняются без ветвлений, так что компилятор может превратить их в
+            несколько векторных сравнений.
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+        bool blocks_intersect (RandomAccessIterator1 left, RandomAccessIterator2 right)
+        {
+            auto matches = 0u;
+            for (std::size_t i = 0; i < intersect_block_size; ++i)
+            {
+                const auto value = left[static_cast<std::ptrdiff_t>(i)];
+                for (std::size_t j = 0; j < intersect_block_size; ++j)
+                {
+                    matches |= static_cast<unsigned>(value == right[static_cast<std::ptrdiff_t>(j)]);
+                }
+            }
+
+            return matches != 0;
+        }
+
+        //!     Пропустить первый блок диапазона, не имеющий общих элементов с блоком другого.
+        /*!
+                Последний элемент пропускаемого блока должен быть меньше последнего элемента
+            блока другого диапазона.
+                Кроме самого блока пропускаются и все следующие за ним элементы, меньшие
+            ближайшего элемента другого блока, который больше последнего элемента пропущенного
+            блока: ни один из них не может встретиться в другом диапазоне. Если и следующий блок
+            целиком меньше этого элемента, то плотности диапазонов, скорее всего, сильно
+            различаются, и пропуск будет намного длиннее блока, поэтому он делается скачками.
+         */
+        template <typename RandomAccessRange, typename RandomAccessIterator>
+        void skip_block (RandomAccessRange & range, RandomAccessIterator other_block)
+        {
+            const auto block_size = static_cast<std::ptrdiff_t>(intersect_block_size);
+            const auto last = range.begin()[block_size - 1];
+
+            auto not_greater = std::ptrdiff_t{0};
+            for (auto i = std::ptrdiff_t{0}; i < block_size; ++i)
+            {
+                not_greater += static_cast<std::ptrdiff_t>(other_block[i] <= last);
+            }
+
+            range.advance_begin(block_size);
+            const auto & goal = other_block[not_greater];
+            if (std::distance(range.begin(), range.end()) > block_size && range.begin()[block_size - 1] < goal)
+            {
+                range.advance_begin(block_size);
+                skip_to_lower_bound(range, goal, std::less<>{}, galloping_skip);
+            }
+        }
+
+        //!     Сделать несколько шагов обычного пересечения.
+        /*!
+                Продвигает диапазон с меньшим первым элементом на один элемент, пока первые
+            элементы не совпадут, пока один из диапазонов не закончится или пока не будет сделано
+            `intersect_scalar_steps` шагов.
+                Возвращает `true`, если все шаги сделаны, а общий элемент так и не встретился.
+         */
+        template <typename RandomAccessRange>
+        bool missed_by_scalar_steps (RandomAccessRange & left, RandomAccessRange & right)
+        {
+            for (std::size_t step = 0; step < intersect_scalar_steps; ++step)
+            {
+                if (left.empty() || right.empty())
+                {
+                    return false;
+                }
+
+                if (left.front() < right.front())
+                {
+                    left.advance_begin(1);
+                }
+                else if (right.front() < left.front())
+                {
+                    right.advance_begin(1);
+                }
+                else
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        //!     Пропустить блоки двух диапазонов, не имеющие общих элементов.
+        /*!
+                Сначала делает несколько шагов обычного пересечения (см.
+            `intersect_scalar_steps`). Если за эти шаги общий элемент нашёлся, то блоки не
+            сравниваются вовсе.
+                Пока в начале обоих диапазонов есть по целому блоку, и у этих блоков нет общих
+            элементов, пропускает блок того диапазона, у которого последний элемент блока меньше:
+            ни один элемент его блока не может встретиться в другом диапазоне.
+                Останавливается, когда блоки пересеклись или когда одному из диапазонов не хватило
+            элементов на целый блок. После этого пересечение досчитывается обычным способом, и до
+            ближайшего общего элемента остаётся не более одного блока.
+         */
+        template <typename RandomAccessRange>
+        void skip_disjoint_blocks (RandomAccessRange & left, RandomAccessRange & right)
+        {
+            if (not missed_by_scalar_steps(left, right))
+            {
+                return;
+            }
+
+            const auto block_size = static_cast<std::ptrdiff_t>(intersect_block_size);
+            while (std::distance(left.begin(), left.end()) >= block_size &&
+                std::distance(right.begin(), right.end()) >= block_size)
+            {
+                const auto left_block = left.begin();
+                const auto right_block = right.begin();
+                if (blocks_intersect(left_block, right_block))
+                {
+                    return;
+                }
+
+                if (left_block[block_size - 1] < right_block[block_size - 1])
+                {
+                    skip_block(left, right_block);
+                }
+                else
+                {
+                    skip_block(right, left_block);
+                }
+            }
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_ITERATOR_DETAIL_INTERSECT_BLOCKS_HPP
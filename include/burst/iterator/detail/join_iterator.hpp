@@ -8,21 +8,63 @@
 #include <boost/next_prior.hpp>
 #include <boost/range/difference_type.hpp>
 #include <boost/range/distance.hpp>
+#include <boost/range/iterator.hpp>
 #include <boost/range/reference.hpp>
 #include <boost/range/value_type.hpp>
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdlib>
 #include <iterator>
+#include <memory>
 #include <numeric>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace burst
 {
     namespace detail
     {
+        //!     Свойства сегментированного итератора, общие для итераторов склейки.
+        /*!
+                Сегменты — это склеиваемые диапазоны, а локальные итераторы — их итераторы.
+         */
+        template <typename JoinIterator, typename RandomAccessIterator>
+        struct join_segmented_iterator_traits
+        {
+            using is_segmented_iterator = std::true_type;
+            using segment_iterator = RandomAccessIterator;
+            using local_iterator =
+                typename boost::range_iterator<typename std::iterator_traits<segment_iterator>::value_type>::type;
+
+            static segment_iterator segment (const JoinIterator & iterator)
+            {
+                return iterator.segment();
+            }
+
+            static local_iterator local (const JoinIterator & iterator)
+            {
+                return iterator.local();
+            }
+
+            static local_iterator begin (segment_iterator segment)
+            {
+                return segment->begin();
+            }
+
+            static local_iterator end (segment_iterator segment)
+            {
+                return segment->end();
+            }
+
+            static JoinIterator compose (const JoinIterator & origin, segment_iterator segment, local_iterator local)
+            {
+                return origin.compose(std::move(segment), std::move(local));
+            }
+        };
+
         //!     Однопроходный итератор склейки.
         /*!
                 Специализация итератора склейки для того случая, когда склеиваемые диапазоны не
@@ -385,6 +427,66 @@ namespace burst
             }
 
         private:
+            friend struct join_segmented_iterator_traits<join_iterator_impl, outer_range_iterator>;
+
+            //!     Склеиваемый диапазон, которому принадлежит текущая позиция.
+            /*!
+                    Для итератора на конец склейки — последний из склеиваемых диапазонов.
+             */
+            outer_range_iterator segment () const
+            {
+                return m_outer != m_end ? m_outer : boost::prior(m_end);
+            }
+
+            inner_range_iterator local () const
+            {
+                return m_inner;
+            }
+
+            //!     Итератор склейки на позицию `local` в диапазоне `segment`.
+            /*!
+                    Позиция должна находиться не раньше текущей. Количество оставшихся элементов
+                вычисляется по количеству элементов между текущей позицией и искомой.
+
+                    Асимптотика.
+
+                Время: O(|R|),
+                    |R| — количество склеиваемых диапазонов между текущей позицией и искомой.
+
+                Память: O(1).
+             */
+            join_iterator_impl compose (outer_range_iterator segment, inner_range_iterator local) const
+            {
+                if (m_outer == m_end)
+                {
+                    return *this;
+                }
+
+                auto items_passed = typename base_type::difference_type{0};
+                if (m_outer == segment)
+                {
+                    items_passed = std::distance(m_inner, local);
+                }
+                else
+                {
+                    items_passed =
+                        std::accumulate(std::next(m_outer), segment, std::distance(m_inner, m_outer->end()),
+                            [] (auto v, const auto & r)
+                            {
+                                return v + std::distance(r.begin(), r.end());
+                            });
+                    items_passed += std::distance(segment->begin(), local);
+                }
+
+                auto result = *this;
+                result.m_outer = segment;
+                result.m_inner = local;
+                result.m_items_remaining -= items_passed;
+                result.maintain_invariant();
+
+                return result;
+            }
+
             typename base_type::reference dereference () const
             {
                 return *m_inner;
@@ -411,6 +513,269 @@ namespace burst
 
             typename base_type::difference_type m_items_remaining;
         };
+
+        //!     Итератор склейки произвольного доступа с индексом размеров диапазонов.
+        /*!
+                Текущая позиция задаётся номером элемента во всём склеенном диапазоне. Кроме неё
+            итератор хранит номер текущего внутреннего диапазона и итератор в нём, чтобы
+            разыменование и продвижение на один элемент не требовали поиска.
+                Префиксные суммы размеров диапазонов строятся один раз при создании итератора на
+            начало склейки, и все копии итератора ссылаются на один и тот же их массив.
+         */
+        template <typename RandomAccessIterator>
+        class indexed_join_iterator_impl:
+            public boost::iterator_facade
+            <
+                indexed_join_iterator_impl<RandomAccessIterator>,
+                typename boost::range_value<typename std::iterator_traits<RandomAccessIterator>::value_type>::type,
+                boost::random_access_traversal_tag,
+                typename boost::range_reference<typename std::iterator_traits<RandomAccessIterator>::value_type>::type
+            >
+        {
+        private:
+            using outer_range_iterator = RandomAccessIterator;
+            using inner_range_type = typename std::iterator_traits<outer_range_iterator>::value_type;
+            using inner_range_iterator = typename boost::range_iterator<inner_range_type>::type;
+
+            using base_type =
+                boost::iterator_facade
+                <
+                    indexed_join_iterator_impl,
+                    typename boost::range_value<inner_range_type>::type,
+                    boost::random_access_traversal_tag,
+                    typename boost::range_reference<inner_range_type>::type
+                >;
+
+            using position_type = typename base_type::difference_type;
+            using index_type = std::vector<position_type>;
+
+        public:
+            //!     Создание итератора на начало склеенного диапазона.
+            /*!
+                    Строит массив префиксных сумм размеров диапазонов: i-й элемент массива — это
+                номер первого элемента i-го диапазона в склеенном диапазоне, а последний — общее
+                количество элементов.
+
+                    Асимптотика.
+
+                Время: O(|R|).
+                Память: O(|R|).
+             */
+            explicit indexed_join_iterator_impl (outer_range_iterator first, outer_range_iterator last):
+                m_begin(std::move(first)),
+                m_index(build_index(m_begin, last)),
+                m_range(0),
+                m_inner{},
+                m_position(0)
+            {
+                seek();
+            }
+
+            //!     Создание итератора на конец склеенного диапазона.
+            /*!
+                    Берёт индекс у итератора на начало склейки и встаёт за последний элемент.
+
+                    Асимптотика.
+
+                Время: O(1).
+                Память: O(1).
+             */
+            indexed_join_iterator_impl (iterator::end_tag_t, const indexed_join_iterator_impl & begin):
+                m_begin(begin.m_begin),
+                m_index(begin.m_index),
+                m_range(range_count()),
+                m_inner{},
+                m_position(m_index->back())
+            {
+            }
+
+            indexed_join_iterator_impl () = default;
+
+        private:
+            friend class boost::iterator_core_access;
+
+            static std::shared_ptr<const index_type> build_index (outer_range_iterator first, outer_range_iterator last)
+            {
+                auto index = std::make_shared<index_type>();
+                index->reserve(static_cast<std::size_t>(std::distance(first, last)) + 1);
+                index->push_back(0);
+                std::for_each(first, last,
+                    [& index] (const auto & range)
+                    {
+                        index->push_back(index->back() + static_cast<position_type>(range.size()));
+                    });
+
+                return index;
+            }
+
+            std::size_t range_count () const
+            {
+                return m_index->size() - 1;
+            }
+
+            //!     Номер первого элемента диапазона в склеенном диапазоне.
+            position_type range_start (std::size_t range) const
+            {
+                return (*m_index)[range];
+            }
+
+            //!     Установить итераторы на элемент с номером `m_position`.
+            /*!
+                    Двоичным поиском по префиксным суммам находит непустой диапазон, которому
+                принадлежит этот элемент. Если элемент находится за концом склейки, то номер
+                диапазона становится равен количеству диапазонов.
+
+                    Асимптотика.
+
+                Время: O(log |R|).
+                Память: O(1).
+             */
+            void seek ()
+            {
+                const auto range_end = std::upper_bound(m_index->begin(), m_index->end(), m_position);
+                m_range = static_cast<std::size_t>(std::distance(m_index->begin(), range_end)) - 1;
+                if (m_range < range_count())
+                {
+                    m_inner = m_begin[static_cast<position_type>(m_range)].begin() + (m_position - range_start(m_range));
+                }
+                else
+                {
+                    m_range = range_count();
+                }
+            }
+
+            //!     Продвижение итератора на n позиций.
+            /*!
+                    Асимптотика.
+
+                Время: O(log |R|).
+                Память: O(1).
+             */
+            void advance (position_type n)
+            {
+                m_position += n;
+                seek();
+            }
+
+            //!     Продвижение итератора на один элемент вперёд.
+            /*!
+                    Если текущий диапазон закончился, то пропускает пустые диапазоны, идущие за ним,
+                просто перебирая их.
+
+                    Асимптотика.
+
+                Время: O(1) в среднем при последовательном проходе по склейке.
+                Память: O(1).
+             */
+            void increment ()
+            {
+                ++m_inner;
+                ++m_position;
+                if (m_position == range_start(m_range + 1))
+                {
+                    do
+                    {
+                        ++m_range;
+                    }
+                    while (m_range < range_count() && range_start(m_range + 1) == m_position);
+
+                    if (m_range < range_count())
+                    {
+                        m_inner = m_begin[static_cast<position_type>(m_range)].begin();
+                    }
+                }
+            }
+
+            //!     Продвижение итератора на один элемент назад.
+            /*!
+                    Аналогичен продвижению вперёд, только двигается в обратном направлении.
+
+                    Асимптотика.
+
+                Время: O(1) в среднем при последовательном проходе по склейке.
+                Память: O(1).
+             */
+            void decrement ()
+            {
+                if (m_range == range_count() || m_position == range_start(m_range))
+                {
+                    do
+                    {
+                        --m_range;
+                    }
+                    while (range_start(m_range) == m_position);
+
+                    m_inner = m_begin[static_cast<position_type>(m_range)].end();
+                }
+
+                --m_inner;
+                --m_position;
+            }
+
+        private:
+            friend struct join_segmented_iterator_traits<indexed_join_iterator_impl, outer_range_iterator>;
+
+            //!     Склеиваемый диапазон, которому принадлежит текущая позиция.
+            /*!
+                    Для итератора на конец склейки — последний из склеиваемых диапазонов.
+             */
+            outer_range_iterator segment () const
+            {
+                const auto range = m_range < range_count() ? m_range : range_count() - 1;
+                return m_begin + static_cast<position_type>(range);
+            }
+
+            inner_range_iterator local () const
+            {
+                return m_range < range_count() ? m_inner : segment()->end();
+            }
+
+            //!     Итератор склейки на позицию `local` в диапазоне `segment`.
+            /*!
+                    Номер элемента вычисляется через префиксную сумму размеров диапазонов, поэтому
+                положение текущего итератора не важно.
+
+                    Асимптотика.
+
+                Время: O(log |R|).
+                Память: O(1).
+             */
+            indexed_join_iterator_impl compose (outer_range_iterator segment, inner_range_iterator local) const
+            {
+                auto result = *this;
+                result.m_position =
+                    range_start(static_cast<std::size_t>(segment - m_begin)) +
+                    std::distance(segment->begin(), local);
+                result.seek();
+
+                return result;
+            }
+
+            typename base_type::reference dereference () const
+            {
+                return *m_inner;
+            }
+
+            bool equal (const indexed_join_iterator_impl & that) const
+            {
+                assert(this->m_begin == that.m_begin);
+                return this->m_position == that.m_position;
+            }
+
+            position_type distance_to (const indexed_join_iterator_impl & that) const
+            {
+                return that.m_position - this->m_position;
+            }
+
+        private:
+            outer_range_iterator m_begin;
+            std::shared_ptr<const index_type> m_index;
+
+            std::size_t m_range;
+            inner_range_iterator m_inner;
+
+            position_type m_position;
+        };
     }
 }
 
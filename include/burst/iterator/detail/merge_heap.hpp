@@ -0,0 +1,65 @@
+#ifndef BURST_ITERATOR_DETAIL_MERGE_HEAP_HPP
+#define BURST_ITERATOR_DETAIL_MERGE_HEAP_HPP
+
+#include <burst/algorithm/galloping_upper_bound.hpp>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Сколько раз подряд должен победить один диапазон, чтобы слияние перешло в скачущий режим.
+        /*!
+                Пока диапазоны перемежаются, поиск длины серии только тратит сравнения, поэтому
+            серию ищут лишь тогда, когда один и тот же диапазон уже несколько раз подряд оказался
+            на вершине пирамиды.
+         */
+        constexpr const std::size_t merge_galloping_threshold = 7;
+
+        //!     Конец серии элементов диапазона, не превосходящих заданного значения.
+        /*!
+                Для диапазонов произвольного доступа ищет конец серии "скачками". Для остальных
+            диапазонов серия ограничивается одним первым элементом: скачущий поиск по ним был бы
+            линейным.
+                Первый элемент диапазона должен не превосходить заданного значения.
+         */
+        template <typename Range, typename Value, typename Compare>
+        auto merge_run_end (Range & range, const Value & value, Compare compare, std::random_access_iterator_tag)
+        {
+            return galloping_upper_bound(boost::begin(range), boost::end(range), value, compare);
+        }
+
+        template <typename Range, typename Value, typename Compare>
+        auto merge_run_end (Range & range, const Value &, Compare, std::input_iterator_tag)
+        {
+            return std::next(boost::begin(range));
+        }
+
+        template <typename Range, typename Value, typename Compare>
+        auto merge_run_end (Range & range, const Value & value, Compare compare)
+        {
+            using iterator = typename boost::range_iterator<Range>::type;
+            using category = typename std::iterator_traits<iterator>::iterator_category;
+            return merge_run_end(range, value, compare, category{});
+        }
+
+        template <typename Range>
+        struct is_gallopable_range:
+            std::is_base_of
+            <
+                std::random_access_iterator_tag,
+                typename std::iterator_traits<typename boost::range_iterator<Range>::type>::iterator_category
+            >
+        {
+        };
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_ITERATOR_DETAIL_MERGE_HEAP_HPP
@@ -0,0 +1,80 @@
+#ifndef BURST_ITERATOR_DETAIL_PREFETCH_HPP
+#define BURST_ITERATOR_DETAIL_PREFETCH_HPP
+
+#include <burst/iterator/prefetch_policy.hpp>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/reference.hpp>
+#include <boost/range/size.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Можно ли заранее подгрузить элементы диапазона по адресу.
+        /*!
+                Для этого диапазон должен быть диапазоном произвольного доступа, а разыменование
+            его итератора должно давать ссылку на элемент, лежащий в памяти.
+         */
+        template <typename Range>
+        struct is_prefetchable_range:
+            std::integral_constant
+            <
+                bool,
+                std::is_base_of
+                <
+                    std::random_access_iterator_tag,
+                    typename std::iterator_traits<typename boost::range_iterator<Range>::type>::iterator_category
+                >
+                ::value
+                &&
+                std::is_lvalue_reference<typename boost::range_reference<Range>::type>::value
+            >
+        {
+        };
+
+        template <typename Range>
+        void prefetch_ahead (const Range &, iterator::no_prefetch_t)
+        {
+        }
+
+        template <typename Range>
+        void prefetch_ahead (const Range & range, iterator::prefetch_t policy, std::true_type)
+        {
+#if defined(__GNUC__)
+            if (policy.distance < static_cast<std::size_t>(boost::size(range)))
+            {
+                const auto ahead = boost::begin(range) + static_cast<std::ptrdiff_t>(policy.distance);
+                __builtin_prefetch(std::addressof(*ahead));
+            }
+#else
+            static_cast<void>(range);
+            static_cast<void>(policy);
+#endif
+        }
+
+        template <typename Range>
+        void prefetch_ahead (const Range &, iterator::prefetch_t, std::false_type)
+        {
+        }
+
+        //!     Подгрузить в кэш элемент диапазона, отстоящий от его начала на заданное расстояние.
+        /*!
+                Вызывается сразу после продвижения диапазона. Если диапазон короче, чем
+            `policy.distance`, то ничего не делает.
+         */
+        template <typename Range>
+        void prefetch_ahead (const Range & range, iterator::prefetch_t policy)
+        {
+            prefetch_ahead(range, policy, is_prefetchable_range<Range>{});
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_ITERATOR_DETAIL_PREFETCH_HPP
@@ -1,12 +1,16 @@
 #ifndef BURST_ITERATOR_DIFFERENCE_ITERATOR_HPP
 #define BURST_ITERATOR_DIFFERENCE_ITERATOR_HPP
 
+#include <burst/iterator/difference_policy.hpp>
 #include <burst/iterator/end_tag.hpp>
+#include <burst/range/detail/skip_to_lower_bound.hpp>
+#include <burst/range/skip_policy.hpp>
 #include <burst/range/skip_to_lower_bound.hpp>
 
 #include <boost/assert.hpp>
 #include <boost/iterator/iterator_concepts.hpp>
 #include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #include <algorithm>
 #include <functional>
@@ -37,6 +41,9 @@ namespace burst
             Бинарная операция, задающая отношение строгого порядка на элементах входных диапазонов.
             Если пользователем явно не указана операция, то, по-умолчанию, берётся отношение
             "меньше", задаваемое функциональным объектом "std::less<>".
+        \tparam DifferencePolicy
+            Способ обхода разности: `iterator::elementwise_difference_t` (по-умолчанию) или
+            `iterator::chunked_difference_t`. Ниже описан поэлементный обход.
 
             Алгоритм работы.
 
@@ -60,12 +67,13 @@ namespace burst
     <
         typename ForwardIterator1,
         typename ForwardIterator2,
-        typename Compare = std::less<>
+        typename Compare = std::less<>,
+        typename DifferencePolicy = iterator::elementwise_difference_t
     >
     class difference_iterator:
         public boost::iterator_facade
         <
-            difference_iterator<ForwardIterator1, ForwardIterator2, Compare>,
+            difference_iterator<ForwardIterator1, ForwardIterator2, Compare, DifferencePolicy>,
             typename std::iterator_traits<ForwardIterator1>::value_type,
             boost::forward_traversal_tag,
             typename std::iterator_traits<ForwardIterator1>::reference
@@ -186,6 +194,152 @@ namespace burst
         compare_type m_compare;
     };
 
+    //!     Итератор разности множеств, обходящий разность кусками.
+    /*!
+            Принимает те же диапазоны, что и поэлементный итератор разности, но перемещается не по
+        отдельным элементам разности, а по наибольшим непрерывным кускам уменьшаемого, целиком
+        входящим в разность. Каждый кусок — непустой поддиапазон уменьшаемого. Конкатенация всех
+        кусков даёт ту же последовательность, что и поэлементный обход.
+            Через куски можно изменять элементы уменьшаемого.
+
+            Алгоритм работы.
+
+        1. Начало очередного куска находится так же, как и текущий элемент при поэлементном
+           обходе: совпадающие элементы уменьшаемого и вычитаемого выбрасываются попарно, пока
+           первый элемент уменьшаемого не станет строго меньше первого элемента вычитаемого.
+        2. Конец куска — это первый элемент уменьшаемого, равный какому-нибудь элементу
+           вычитаемого. Уменьшаемое продвигается до первого элемента, не меньшего первого элемента
+           вычитаемого. Если этот элемент оказался больше, то первого элемента вычитаемого в
+           уменьшаемом нет, поэтому вычитаемое продвигается до элемента, не меньшего текущего
+           элемента уменьшаемого, и кусок продолжается. Если диапазоны — диапазоны произвольного
+           доступа, то оба продвижения делаются "скачками", так что длинный кусок находится за
+           логарифмическое от его длины количество сравнений.
+        3. При переходе к следующему куску п.1 исполняется, начиная с конца текущего куска.
+     */
+    template
+    <
+        typename ForwardIterator1,
+        typename ForwardIterator2,
+        typename Compare
+    >
+    class difference_iterator<ForwardIterator1, ForwardIterator2, Compare, iterator::chunked_difference_t>:
+        public boost::iterator_facade
+        <
+            difference_iterator<ForwardIterator1, ForwardIterator2, Compare, iterator::chunked_difference_t>,
+            boost::iterator_range<ForwardIterator1>,
+            boost::forward_traversal_tag,
+            boost::iterator_range<ForwardIterator1>
+        >
+    {
+    private:
+        BOOST_CONCEPT_ASSERT((boost::ForwardIteratorConcept<ForwardIterator1>));
+        BOOST_CONCEPT_ASSERT((boost::ForwardIteratorConcept<ForwardIterator2>));
+        using minuend_iterator = ForwardIterator1;
+        using subtrahend_iterator = ForwardIterator2;
+        using compare_type = Compare;
+
+        using base_type =
+            boost::iterator_facade
+            <
+                difference_iterator,
+                boost::iterator_range<minuend_iterator>,
+                boost::forward_traversal_tag,
+                boost::iterator_range<minuend_iterator>
+            >;
+
+    public:
+        difference_iterator
+            (
+                minuend_iterator minuend_begin,
+                minuend_iterator minuend_end,
+                subtrahend_iterator subtrahend_begin,
+                subtrahend_iterator subtrahend_end,
+                Compare compare = Compare()
+            ):
+            m_chunk_begin(minuend_begin),
+            m_chunk_end(std::move(minuend_begin)),
+            m_minuend_end(std::move(minuend_end)),
+            m_subtrahend(std::move(subtrahend_begin), std::move(subtrahend_end)),
+            m_compare(compare)
+        {
+            BOOST_ASSERT(std::is_sorted(m_chunk_begin, m_minuend_end, compare));
+            BOOST_ASSERT(std::is_sorted(m_subtrahend.begin(), m_subtrahend.end(), compare));
+
+            settle();
+        }
+
+        difference_iterator (iterator::end_tag_t, const difference_iterator & begin):
+            m_chunk_begin(begin.m_minuend_end),
+            m_chunk_end(begin.m_minuend_end),
+            m_minuend_end(begin.m_minuend_end),
+            m_subtrahend{},
+            m_compare(begin.m_compare)
+        {
+        }
+
+    private:
+        friend class boost::iterator_core_access;
+
+        void increment ()
+        {
+            settle();
+        }
+
+        //!     Найти кусок разности, начинающийся не раньше конца текущего куска
+        /*!
+                Подробно описано в п.1 и п.2 алгоритма работы.
+                Если уменьшаемое закончилось, то итератор устанавливается на конец разности.
+         */
+        void settle ()
+        {
+            auto minuend = boost::make_iterator_range(m_chunk_end, m_minuend_end);
+            while (not minuend.empty()
+                && not m_subtrahend.empty()
+                && not m_compare(minuend.front(), m_subtrahend.front()))
+            {
+                if (not m_compare(m_subtrahend.front(), minuend.front()))
+                {
+                    minuend.advance_begin(1);
+                    m_subtrahend.advance_begin(1);
+                }
+                else
+                {
+                    detail::skip_to_lower_bound(m_subtrahend, minuend.front(), m_compare, galloping_skip);
+                }
+            }
+            m_chunk_begin = minuend.begin();
+
+            while (not m_subtrahend.empty())
+            {
+                detail::skip_to_lower_bound(minuend, m_subtrahend.front(), m_compare, galloping_skip);
+                if (minuend.empty() || not m_compare(m_subtrahend.front(), minuend.front()))
+                {
+                    break;
+                }
+                detail::skip_to_lower_bound(m_subtrahend, minuend.front(), m_compare, galloping_skip);
+            }
+            m_chunk_end = not m_subtrahend.empty() ? minuend.begin() : m_minuend_end;
+        }
+
+    private:
+        typename base_type::reference dereference () const
+        {
+            return boost::make_iterator_range(m_chunk_begin, m_chunk_end);
+        }
+
+        bool equal (const difference_iterator & that) const
+        {
+            return this->m_chunk_begin == that.m_chunk_begin;
+        }
+
+    private:
+        minuend_iterator m_chunk_begin;
+        minuend_iterator m_chunk_end;
+        minuend_iterator m_minuend_end;
+        boost::iterator_range<subtrahend_iterator> m_subtrahend;
+        compare_type m_compare;
+    };
+
     //!     Функция для создания итератора разности с предикатом.
     /*!
             Принимает на вход два диапазона, разность которых нужно найти, и операцию, задающую
@@ -278,22 +432,114 @@ namespace burst
             );
     }
 
+    //!     Функция для создания итератора разности с заданным способом обхода.
+    /*!
+            Аналогична функциям создания итератора разности, но первым аргументом принимает способ
+        обхода разности (см. `iterator::chunked_difference_t`).
+     */
+    template <typename ForwardIterator1, typename ForwardIterator2, typename Compare>
+    auto
+        make_difference_iterator
+        (
+            iterator::chunked_difference_t,
+            ForwardIterator1 minuend_begin, ForwardIterator1 minuend_end,
+            ForwardIterator2 subtrahend_begin, ForwardIterator2 subtrahend_end,
+            Compare compare
+        )
+    {
+        using difference_iterator_type =
+            difference_iterator<ForwardIterator1, ForwardIterator2, Compare, iterator::chunked_difference_t>;
+        return
+            difference_iterator_type
+            (
+                std::move(minuend_begin),
+                std::move(minuend_end),
+                std::move(subtrahend_begin),
+                std::move(subtrahend_end),
+                compare
+            );
+    }
+
+    template <typename ForwardRange1, typename ForwardRange2, typename Compare>
+    auto
+        make_difference_iterator
+        (
+            iterator::chunked_difference_t policy,
+            ForwardRange1 && minuend,
+            ForwardRange2 && subtrahend,
+            Compare compare
+        )
+    {
+        using std::begin;
+        using std::end;
+        return
+            make_difference_iterator
+            (
+                policy,
+                begin(std::forward<ForwardRange1>(minuend)),
+                end(std::forward<ForwardRange1>(minuend)),
+                begin(std::forward<ForwardRange2>(subtrahend)),
+                end(std::forward<ForwardRange2>(subtrahend)),
+                compare
+            );
+    }
+
+    template <typename ForwardIterator1, typename ForwardIterator2>
+    auto
+        make_difference_iterator
+        (
+            iterator::chunked_difference_t policy,
+            ForwardIterator1 minuend_begin, ForwardIterator1 minuend_end,
+            ForwardIterator2 subtrahend_begin, ForwardIterator2 subtrahend_end
+        )
+    {
+        return
+            make_difference_iterator
+            (
+                policy,
+                std::move(minuend_begin),
+                std::move(minuend_end),
+                std::move(subtrahend_begin),
+                std::move(subtrahend_end),
+                std::less<>{}
+            );
+    }
+
+    template <typename ForwardRange1, typename ForwardRange2>
+    auto
+        make_difference_iterator
+        (
+            iterator::chunked_difference_t policy,
+            ForwardRange1 && minuend,
+            ForwardRange2 && subtrahend
+        )
+    {
+        return
+            make_difference_iterator
+            (
+                policy,
+                std::forward<ForwardRange1>(minuend),
+                std::forward<ForwardRange2>(subtrahend),
+                std::less<>{}
+            );
+    }
+
     //!     Функция для создания итератора на конец разности с предикатом.
     /*!
             Принимает на вход итератор на начало разности и индикатор конца итератора.
             Возвращает итератор-конец, который, если до него дойти, покажет, что элементы разности
         закончились.
      */
-    template <typename ForwardIterator1, typename ForwardIterator2, typename Compare>
+    template <typename ForwardIterator1, typename ForwardIterator2, typename Compare, typename DifferencePolicy>
     auto
         make_difference_iterator
         (
             iterator::end_tag_t,
-            const difference_iterator<ForwardIterator1, ForwardIterator2, Compare> & begin
+            const difference_iterator<ForwardIterator1, ForwardIterator2, Compare, DifferencePolicy> & begin
         )
     {
         return
-            difference_iterator<ForwardIterator1, ForwardIterator2, Compare>
+            difference_iterator<ForwardIterator1, ForwardIterator2, Compare, DifferencePolicy>
             (
                 iterator::end_tag,
                 begin
@@ -0,0 +1,34 @@
+#ifndef BURST_ITERATOR_DIFFERENCE_POLICY_HPP
+#define BURST_ITERATOR_DIFFERENCE_POLICY_HPP
+
+namespace burst
+{
+    namespace iterator
+    {
+        //!     Поэлементный обход разности.
+        /*!
+                Итератор разности перемещается по отдельным элементам уменьшаемого.
+                Используется по-умолчанию.
+         */
+        struct elementwise_difference_t {};
+
+        //!     Константа, обозначающая поэлементный обход разности.
+        const elementwise_difference_t elementwise_difference{};
+
+        //!     Обход разности кусками.
+        /*!
+                Итератор разности перемещается по наибольшим непрерывным кускам уменьшаемого, в
+            которых нет ни одного элемента вычитаемого. Каждый кусок — это поддиапазон
+            уменьшаемого, конец которого ищется "скачками" попеременно по уменьшаемому и
+            вычитаемому: элементы вычитаемого, которых нет в уменьшаемом, кусок не прерывают.
+                Выгоден, когда из большого уменьшаемого вычитается небольшое вычитаемое: тогда
+            кусков мало, и каждый из них можно обработать целиком.
+         */
+        struct chunked_difference_t {};
+
+        //!     Константа, обозначающая обход разности кусками.
+        const chunked_difference_t chunked_difference{};
+    }
+}
+
+#endif // BURST_ITERATOR_DIFFERENCE_POLICY_HPP
@@ -3,8 +3,11 @@
 
 #include <burst/container/access/front.hpp>
 #include <burst/functional/each.hpp>
+#include <burst/iterator/detail/intersect_blocks.hpp>
+#include <burst/iterator/detail/prefetch.hpp>
 #include <burst/iterator/detail/prevent_writing.hpp>
 #include <burst/iterator/end_tag.hpp>
+#include <burst/iterator/prefetch_policy.hpp>
 #include <burst/range/skip_to_lower_bound.hpp>
 
 #include <boost/algorithm/cxx11/is_sorted.hpp>
@@ -18,6 +21,7 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <type_traits>
 #include <utility>
 
 namespace burst
@@ -41,6 +45,10 @@ namespace burst
             Бинарная операция, задающая отношение строгого порядка на элементах внутренних
             диапазонов. Если пользователем явно не указана операция, то, по-умолчанию, берётся
             отношение "меньше", задаваемое функциональным объектом "std::less<>".
+        \tparam PrefetchPolicy
+            Упреждающая выборка элементов продвигаемых диапазонов: `iterator::no_prefetch_t`
+            (по-умолчанию) или `iterator::prefetch_t`. Выборка делается и после продвижения на
+            один элемент, и после скачка.
 
             Алгоритм работы.
 
@@ -59,16 +67,22 @@ namespace burst
            равновесия" набор диапазонов, продвинув каждый из них ровно на один элемент вперёд, и
            поддержать инвариант, установив диапазон с наибольшим первым элементом в конец массива,
            после чего исполнить п.2.
+
+            Если пересекаются ровно два диапазона произвольного доступа из целых чисел, а
+        отношение порядка — стандартное "меньше", и несколько шагов п.2 не нашли общего элемента,
+        то диапазоны продвигаются целыми блоками, пока блоки не имеют общих элементов (см.
+        `detail::skip_disjoint_blocks`).
      */
     template
     <
         typename RandomAccessIterator,
-        typename Compare = std::less<>
+        typename Compare = std::less<>,
+        typename PrefetchPolicy = iterator::no_prefetch_t
     >
     class intersect_iterator:
         public boost::iterator_facade
         <
-            intersect_iterator<RandomAccessIterator, Compare>,
+            intersect_iterator<RandomAccessIterator, Compare, PrefetchPolicy>,
             typename boost::range_value
             <
                 typename std::iterator_traits<RandomAccessIterator>::value_type
@@ -107,11 +121,13 @@ namespace burst
         explicit intersect_iterator
             (
                 outer_range_iterator first, outer_range_iterator last,
-                Compare compare = Compare()
+                Compare compare = Compare(),
+                PrefetchPolicy prefetch = PrefetchPolicy()
             ):
             m_begin{},
             m_end{},
-            m_compare(compare)
+            m_compare(compare),
+            m_prefetch(prefetch)
         {
             if (std::none_of(first, last, [] (const auto & range) {return range.empty();}))
             {
@@ -131,7 +147,8 @@ namespace burst
         intersect_iterator (iterator::end_tag_t, const intersect_iterator & begin):
             m_begin(begin.m_begin),
             m_end(begin.m_begin),
-            m_compare(begin.m_compare)
+            m_compare(begin.m_compare),
+            m_prefetch(begin.m_prefetch)
         {
         }
 
@@ -161,6 +178,7 @@ namespace burst
             for (auto range = m_begin; range != m_end; ++range)
             {
                 range->advance_begin(1);
+                detail::prefetch_ahead(*range, m_prefetch);
                 if (range->empty())
                 {
                     scroll_to_end();
@@ -188,6 +206,8 @@ namespace burst
          */
         void settle ()
         {
+            skip_disjoint_blocks(detail::is_block_intersectable<inner_range_type, compare_type>{});
+
             if (m_begin != m_end)
             {
                 const auto max_range = std::prev(m_end);
@@ -198,6 +218,7 @@ namespace burst
                     if (m_compare(range->front(), max_range->front()))
                     {
                         skip_to_lower_bound(*range, max_range->front(), m_compare);
+                        detail::prefetch_ahead(*range, m_prefetch);
                         if (range->empty())
                         {
                             scroll_to_end();
@@ -221,9 +242,41 @@ namespace burst
             }
         }
 
+        //!     Пропустить блоки двух диапазонов, не имеющие общих элементов.
+        /*!
+                Работает только тогда, когда пересекаются ровно два диапазона. После пропуска
+            восстанавливает инвариант: диапазон с наибольшим первым элементом стоит последним.
+         */
+        void skip_disjoint_blocks (std::true_type)
+        {
+            if (std::distance(m_begin, m_end) == 2)
+            {
+                const auto last = std::next(m_begin);
+                detail::skip_disjoint_blocks(*m_begin, *last);
+                if (m_begin->empty() || last->empty())
+                {
+                    scroll_to_end();
+                }
+                else if (m_compare(last->front(), m_begin->front()))
+                {
+                    std::iter_swap(m_begin, last);
+                }
+            }
+        }
+
+        void skip_disjoint_blocks (std::false_type)
+        {
+        }
+
+        //!     Установить итератор на конец пересечений.
+        /*!
+                Конец вычисляется сдвигом, а не присваиванием `m_end = m_begin`: GCC 12 с
+            оптимизацией -O2 терял такую запись, если `settle` не встраивался в вызывающий код, и
+            итератор продолжал выдавать элементы из-за концов диапазонов.
+         */
         void scroll_to_end ()
         {
-            m_end = m_begin;
+            m_end = std::prev(m_end, std::distance(m_begin, m_end));
         }
 
     private:
@@ -242,6 +295,7 @@ namespace burst
         outer_range_iterator m_begin;
         outer_range_iterator m_end;
         compare_type m_compare;
+        PrefetchPolicy m_prefetch;
     };
 
     //!     Функция для создания итератора пересечения с предикатом.
@@ -306,6 +360,56 @@ namespace burst
             );
     }
 
+    //!     Функция для создания итератора пересечения с упреждающей выборкой.
+    /*!
+            Аналогична функциям создания итератора пересечения, но первым аргументом принимает
+        настройки упреждающей выборки (см. `iterator::prefetch_t`).
+     */
+    template <typename RandomAccessIterator, typename Compare>
+    auto
+        make_intersect_iterator
+        (
+            iterator::prefetch_t prefetch,
+            RandomAccessIterator first, RandomAccessIterator last,
+            Compare compare
+        )
+    {
+        return
+            intersect_iterator<RandomAccessIterator, Compare, iterator::prefetch_t>
+            (
+                std::move(first), std::move(last),
+                compare,
+                prefetch
+            );
+    }
+
+    template <typename RandomAccessRange, typename Compare>
+    auto make_intersect_iterator (iterator::prefetch_t prefetch, RandomAccessRange && ranges, Compare compare)
+    {
+        using std::begin;
+        using std::end;
+        return
+            make_intersect_iterator
+            (
+                prefetch,
+                begin(std::forward<RandomAccessRange>(ranges)),
+                end(std::forward<RandomAccessRange>(ranges)),
+                compare
+            );
+    }
+
+    template <typename RandomAccessIterator>
+    auto make_intersect_iterator (iterator::prefetch_t prefetch, RandomAccessIterator first, RandomAccessIterator last)
+    {
+        return make_intersect_iterator(prefetch, std::move(first), std::move(last), std::less<>{});
+    }
+
+    template <typename RandomAccessRange>
+    auto make_intersect_iterator (iterator::prefetch_t prefetch, RandomAccessRange && ranges)
+    {
+        return make_intersect_iterator(prefetch, std::forward<RandomAccessRange>(ranges), std::less<>{});
+    }
+
     //!     Функция для создания итератора на конец пересечения.
     /*!
             Принимает на вход итератор на начало пересекаемых диапазонов и индикатор конца
@@ -313,15 +417,15 @@ namespace burst
             Возвращает итератор-конец, который, если до него дойти, покажет, что элементы
         пересечения закончились.
      */
-    template <typename RandomAccessRange, typename Compare>
+    template <typename RandomAccessRange, typename Compare, typename PrefetchPolicy>
     auto
         make_intersect_iterator
         (
             iterator::end_tag_t,
-            const intersect_iterator<RandomAccessRange, Compare> & begin
+            const intersect_iterator<RandomAccessRange, Compare, PrefetchPolicy> & begin
         )
     {
-        return intersect_iterator<RandomAccessRange, Compare>(iterator::end_tag, begin);
+        return intersect_iterator<RandomAccessRange, Compare, PrefetchPolicy>(iterator::end_tag, begin);
     }
 } // namespace burst
 
@@ -3,8 +3,11 @@
 
 #include <burst/iterator/detail/join_iterator.hpp>
 #include <burst/iterator/end_tag.hpp>
+#include <burst/iterator/join_policy.hpp>
+#include <burst/iterator/segmented_iterator_traits.hpp>
 #include <burst/range/pure_traversal.hpp>
 
+#include <boost/iterator/iterator_categories.hpp>
 #include <boost/iterator/minimum_category.hpp>
 #include <boost/range/value_type.hpp>
 
@@ -41,7 +44,9 @@ namespace burst
                Если внешний диапазон и внутренние диапазоны одновременно являются диапазонами
                произвольного доступа, то итератор склейки будет итератором произвольного доступа,
                правда, с одной оговоркой: продвижение итератора на n шагов будет происходить не за
-               O(1), а за O(|R|), где |R| — количество склеиваемых диапазонов.
+               O(1), а за O(|R|), где |R| — количество склеиваемых диапазонов. Если склеивается
+               много коротких диапазонов, а по склейке нужно много прыгать, то лучше использовать
+               итератор склейки с индексом (см. `indexed_join_iterator`).
 
             2. Однопроходный итератор.
 
@@ -84,6 +89,36 @@ namespace burst
             ::type
         >;
 
+    //!     Итератор склейки с индексом размеров диапазонов.
+    /*!
+            Итератор произвольного доступа по склейке диапазонов произвольного доступа, который
+        продвигается на n позиций за O(log |R|), а расстояние между итераторами вычисляет за O(1).
+        Для этого при создании итератора на начало склейки один раз строится массив префиксных
+        сумм размеров диапазонов (см. `iterator::indexed_join_t`).
+     */
+    template <typename RandomAccessIterator>
+    using indexed_join_iterator = detail::indexed_join_iterator_impl<RandomAccessIterator>;
+
+    //!     Итератор склейки произвольного доступа — сегментированный итератор.
+    /*!
+            Сегментами являются склеиваемые диапазоны (см. `segmented_iterator_traits`).
+     */
+    template <typename RandomAccessIterator>
+    struct segmented_iterator_traits<detail::join_iterator_impl<RandomAccessIterator, boost::random_access_traversal_tag>>:
+        detail::join_segmented_iterator_traits
+        <
+            detail::join_iterator_impl<RandomAccessIterator, boost::random_access_traversal_tag>,
+            RandomAccessIterator
+        >
+    {
+    };
+
+    template <typename RandomAccessIterator>
+    struct segmented_iterator_traits<indexed_join_iterator<RandomAccessIterator>>:
+        detail::join_segmented_iterator_traits<indexed_join_iterator<RandomAccessIterator>, RandomAccessIterator>
+    {
+    };
+
     //!     Функция для создания итератора склейки.
     /*!
             Принимает на вход набор диапазонов, которые нужно склеить.
@@ -109,6 +144,31 @@ namespace burst
             );
     }
 
+    //!     Функция для создания итератора склейки с индексом размеров диапазонов.
+    /*!
+            Аналогична предыдущим, но первым аргументом принимает способ склейки (см.
+        `iterator::indexed_join_t`).
+     */
+    template <typename RandomAccessIterator>
+    auto make_join_iterator (iterator::indexed_join_t, RandomAccessIterator first, RandomAccessIterator last)
+    {
+        return indexed_join_iterator<RandomAccessIterator>(std::move(first), std::move(last));
+    }
+
+    template <typename RandomAccessRange>
+    auto make_join_iterator (iterator::indexed_join_t policy, RandomAccessRange && ranges)
+    {
+        using std::begin;
+        using std::end;
+        return
+            make_join_iterator
+            (
+                policy,
+                begin(std::forward<RandomAccessRange>(ranges)),
+                end(std::forward<RandomAccessRange>(ranges))
+            );
+    }
+
     //!     Функция для создания итератора на конец склейки.
     /*!
             Принимает на вход итератор на начало склеенного диапазона и специальную метку,
@@ -120,6 +180,12 @@ namespace burst
     {
         return join_iterator<Iterator>(iterator::end_tag, begin);
     }
+
+    template <typename RandomAccessIterator>
+    auto make_join_iterator (iterator::end_tag_t, const indexed_join_iterator<RandomAccessIterator> & begin)
+    {
+        return indexed_join_iterator<RandomAccessIterator>(iterator::end_tag, begin);
+    }
 } // namespace burst
 
 #endif // BURST_ITERATOR_JOIN_ITERATOR_HPP
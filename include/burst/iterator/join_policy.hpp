@@ -0,0 +1,28 @@
+#ifndef BURST_ITERATOR_JOIN_POLICY_HPP
+#define BURST_ITERATOR_JOIN_POLICY_HPP
+
+namespace burst
+{
+    namespace iterator
+    {
+        //!     Склейка с индексом размеров диапазонов.
+        /*!
+                При создании итератора склейки строится массив префиксных сумм размеров склеиваемых
+            диапазонов, общий для всех копий итератора. Благодаря ему продвижение на n позиций
+            выполняется двоичным поиском по этому массиву за O(log |R|) вместо O(|R|), где |R| —
+            количество склеиваемых диапазонов.
+                Требует O(|R|) дополнительной памяти. Применим только тогда, когда и внешний, и
+            внутренние диапазоны — диапазоны произвольного доступа.
+                Копии итератора совместно владеют массивом префиксных сумм, поэтому копирование
+            итератора дороже, чем у обычной склейки. Алгоритмы, которые в основном ходят по
+            диапазону последовательно и при этом часто копируют итераторы (например,
+            `std::nth_element`), с индексом работают медленнее.
+         */
+        struct indexed_join_t {};
+
+        //!     Константа, обозначающая склейку с индексом размеров диапазонов.
+        const indexed_join_t indexed_join{};
+    }
+}
+
+#endif // BURST_ITERATOR_JOIN_POLICY_HPP
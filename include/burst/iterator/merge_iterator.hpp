@@ -1,10 +1,12 @@
 #ifndef BURST_ITERATOR_MERGE_ITERATOR_HPP
 #define BURST_ITERATOR_MERGE_ITERATOR_HPP
 
-#include <burst/container/access/front.hpp>
-#include <burst/functional/each.hpp>
-#include <burst/functional/invert.hpp>
+#include <burst/iterator/detail/front_heap.hpp>
+#include <burst/iterator/detail/merge_heap.hpp>
+#include <burst/iterator/detail/prefetch.hpp>
 #include <burst/iterator/end_tag.hpp>
+#include <burst/iterator/merge_policy.hpp>
+#include <burst/iterator/prefetch_policy.hpp>
 
 #include <boost/algorithm/cxx11/is_sorted.hpp>
 #include <boost/assert.hpp>
@@ -14,9 +16,13 @@
 #include <boost/range/value_type.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <iterator>
+#include <limits>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace burst
 {
@@ -37,25 +43,44 @@ namespace burst
             Бинарная операция, задающая отношение строгого порядка на элементах внутренних
             диапазонов. Если пользователем явно не указана операция, то, по-умолчанию, берётся
             отношение "меньше", задаваемое функциональным объектом "std::less<>".
+        \tparam MergePolicy
+            Способ слияния: `iterator::heap_merge_t` (по-умолчанию) или
+            `iterator::loser_tree_merge_t`. Ниже описан алгоритм слияния пирамидой.
+        \tparam PrefetchPolicy
+            Упреждающая выборка элементов продвигаемых диапазонов: `iterator::no_prefetch_t`
+            (по-умолчанию) или `iterator::prefetch_t`.
 
             Алгоритм работы.
 
         1. Внешний диапазон переупорядочивается в структуру "пирамида", в которой его элементы —
            внутренние диапазоны — сравниваются по первому элементу в том же отношении порядка, в
            котором упорядочены элементы в самих диапазонах.
-        2. Каждый раз, когда требуется перейти к следующему элементу слияния, из пирамиды достаётся
-           наименьший диапазон, он продвигается ровно на один элемент вперёд, а затем, если
-           диапазон не стал пустым, кладётся обратно в пирамиду.
+        2. Каждый раз, когда требуется перейти к следующему элементу слияния, наименьший диапазон
+           продвигается ровно на один элемент вперёд, а затем, если диапазон не стал пустым,
+           просеивается вниз по пирамиде. Если же диапазон опустел, то он исключается из пирамиды.
+        3. Если один и тот же диапазон несколько раз подряд остаётся на вершине пирамиды, то
+           слияние переходит в "скачущий" режим: скачущим поиском определяется, сколько ещё
+           элементов этого диапазона не превосходят первого элемента следующего по старшинству
+           диапазона, и на протяжении всей этой серии итератор продвигается без единого
+           сравнения. Для этого внутренние диапазоны должны быть диапазонами произвольного
+           доступа. Иначе скачущий режим не используется.
+        4. Если элементы диапазонов тривиально копируемы, то первые элементы всех диапазонов
+           хранятся в отдельном плотном массиве, который переставляется вместе с диапазонами.
+           Пирамида сравнивает именно их, поэтому просеивание не обращается к памяти самих
+           диапазонов, разбросанной по разным местам, а первый элемент каждого диапазона
+           читается только один раз после его продвижения.
      */
     template
     <
         typename RandomAccessIterator,
-        typename Compare = std::less<>
+        typename Compare = std::less<>,
+        typename MergePolicy = iterator::heap_merge_t,
+        typename PrefetchPolicy = iterator::no_prefetch_t
     >
     class merge_iterator:
         public boost::iterator_facade
         <
-            merge_iterator<RandomAccessIterator, Compare>,
+            merge_iterator<RandomAccessIterator, Compare, MergePolicy, PrefetchPolicy>,
             typename boost::range_value<typename std::iterator_traits<RandomAccessIterator>::value_type>::type,
             boost::single_pass_traversal_tag,
             typename boost::range_reference<typename std::iterator_traits<RandomAccessIterator>::value_type>::type
@@ -75,10 +100,19 @@ namespace burst
             >;
 
     public:
-        explicit merge_iterator (outer_range_iterator first, outer_range_iterator last, Compare compare = Compare()):
+        explicit merge_iterator
+            (
+                outer_range_iterator first, outer_range_iterator last,
+                Compare compare = Compare(),
+                PrefetchPolicy prefetch = PrefetchPolicy()
+            ):
             m_begin(std::move(first)),
             m_end(std::move(last)),
-            m_compare(compare)
+            m_compare(compare),
+            m_prefetch(prefetch),
+            m_fronts(),
+            m_streak(0),
+            m_run(0)
         {
             BOOST_ASSERT(std::all_of(m_begin, m_end,
                 [& compare] (const auto & range)
@@ -87,13 +121,18 @@ namespace burst
                 }));
 
             remove_empty_ranges();
-            std::make_heap(m_begin, m_end, each(front) | invert(m_compare));
+            m_fronts = fronts_type(m_begin, heap_size());
+            detail::make_front_heap(m_fronts, heap_size(), m_compare);
         }
 
         merge_iterator (iterator::end_tag_t, const merge_iterator & begin):
             m_begin(begin.m_begin),
             m_end(begin.m_begin),
-            m_compare(begin.m_compare)
+            m_compare(begin.m_compare),
+            m_prefetch(begin.m_prefetch),
+            m_fronts(),
+            m_streak(0),
+            m_run(0)
         {
         }
 
@@ -102,27 +141,79 @@ namespace burst
     private:
         friend class boost::iterator_core_access;
 
+        using inner_range_type = typename std::iterator_traits<outer_range_iterator>::value_type;
+        using fronts_type = detail::front_cache_t<outer_range_iterator>;
+
         void remove_empty_ranges ()
         {
             m_end = std::remove_if(m_begin, m_end, [] (const auto & r) {return r.empty();});
         }
 
-        void increment ()
+        std::size_t heap_size () const
         {
-            std::pop_heap(m_begin, m_end, each(front) | invert(m_compare));
-            auto & range = *std::prev(m_end);
+            return static_cast<std::size_t>(std::distance(m_begin, m_end));
+        }
 
+        //!     Продвинуть итератор.
+        /*!
+                Во время серии первый элемент вершины не кэшируется: пока серия не кончилась, он
+            ни с чем не сравнивается.
+         */
+        void increment ()
+        {
+            auto & range = *m_begin;
             range.advance_begin(1);
-            if (not range.empty())
+            detail::prefetch_ahead(range, m_prefetch);
+
+            if (m_run > 0)
             {
-                std::push_heap(m_begin, m_end, each(front) | invert(m_compare));
+                --m_run;
             }
-            else
+            else if (range.empty())
             {
+                detail::pop_front_heap(m_fronts, heap_size(), m_compare);
                 --m_end;
+                m_streak = 0;
+            }
+            else
+            {
+                m_fronts.refresh(0);
+                if (detail::sift_front_heap_down(m_fronts, 0, heap_size(), m_compare) == 0)
+                {
+                    ++m_streak;
+                    if (m_streak >= detail::merge_galloping_threshold)
+                    {
+                        start_run(detail::is_gallopable_range<inner_range_type>{});
+                    }
+                }
+                else
+                {
+                    m_streak = 0;
+                }
             }
         }
 
+        //!     Найти серию элементов вершины, которые можно выдать без сравнений.
+        /*!
+                Серия состоит из тех элементов диапазона, стоящего на вершине пирамиды, которые не
+            превосходят первого элемента следующего по старшинству диапазона.
+         */
+        void start_run (std::true_type)
+        {
+            const auto & range = *m_begin;
+            const auto runner_up = detail::front_heap_runner_up(m_fronts, heap_size(), m_compare);
+            const auto run_end =
+                runner_up != heap_size()
+                    ? detail::merge_run_end(range, m_fronts.key(runner_up), m_compare)
+                    : range.end();
+
+            m_run = static_cast<std::size_t>(std::distance(range.begin(), run_end)) - 1;
+        }
+
+        void start_run (std::false_type)
+        {
+        }
+
     private:
         typename base_type::reference dereference () const
         {
@@ -140,6 +231,256 @@ namespace burst
         outer_range_iterator m_end;
 
         Compare m_compare;
+        PrefetchPolicy m_prefetch;
+        fronts_type m_fronts;
+
+        // Сколько раз подряд на вершине пирамиды оказывался один и тот же диапазон.
+        std::size_t m_streak;
+        // Сколько ещё элементов вершины можно выдать без сравнений.
+        std::size_t m_run;
+    };
+
+    //!     Итератор слияния на основе дерева проигравших.
+    /*!
+            Интерфейс и свойства те же, что и у итератора слияния на основе пирамиды.
+
+            Алгоритм работы.
+
+        1. Пустые диапазоны исключаются, и над оставшимися k диапазонами строится турнирное дерево
+           с k листьями, пронумерованное так же, как пирамида: потомки узла `n` — это узлы `2n` и
+           `2n + 1`, а лист `k + i` соответствует i-му диапазону. Во внутренних узлах хранятся
+           номера диапазонов, проигравших в соответствующих "матчах", а в нулевом узле — номер
+           победителя, то есть диапазона с наименьшим первым элементом.
+        2. При продвижении итератора диапазон-победитель продвигается на один элемент, после чего
+           "переигрываются" только матчи на пути от его листа к корню. Опустевший диапазон
+           заменяется фиктивным участником, проигрывающим любому другому.
+        3. Если элементы диапазонов тривиально копируемы, то первые элементы всех диапазонов
+           хранятся в отдельном плотном массиве, и при переигрывании сравниваются именно они.
+     */
+    template <typename RandomAccessIterator, typename Compare, typename PrefetchPolicy>
+    class merge_iterator<RandomAccessIterator, Compare, iterator::loser_tree_merge_t, PrefetchPolicy>:
+        public boost::iterator_facade
+        <
+            merge_iterator<RandomAccessIterator, Compare, iterator::loser_tree_merge_t, PrefetchPolicy>,
+            typename boost::range_value<typename std::iterator_traits<RandomAccessIterator>::value_type>::type,
+            boost::single_pass_traversal_tag,
+            typename boost::range_reference<typename std::iterator_traits<RandomAccessIterator>::value_type>::type
+        >
+    {
+    private:
+        BOOST_CONCEPT_ASSERT((boost::RandomAccessIteratorConcept<RandomAccessIterator>));
+        using outer_range_iterator = RandomAccessIterator;
+        using outer_difference_type = typename std::iterator_traits<outer_range_iterator>::difference_type;
+        using inner_range_type = typename std::iterator_traits<outer_range_iterator>::value_type;
+
+        using base_type =
+            boost::iterator_facade
+            <
+                merge_iterator,
+                typename boost::range_value<inner_range_type>::type,
+                boost::single_pass_traversal_tag,
+                typename boost::range_reference<inner_range_type>::type
+            >;
+
+        using front_value_type = typename boost::range_value<inner_range_type>::type;
+        using fronts_are_cached = std::is_trivially_copyable<front_value_type>;
+        using cached_front_type =
+            std::conditional_t<fronts_are_cached::value, front_value_type, std::nullptr_t>;
+
+        //!     Номер фиктивного участника, проигрывающего любому диапазону.
+        static constexpr std::size_t exhausted_range = std::numeric_limits<std::size_t>::max();
+
+    public:
+        explicit merge_iterator
+            (
+                outer_range_iterator first, outer_range_iterator last,
+                Compare compare = Compare(),
+                PrefetchPolicy prefetch = PrefetchPolicy()
+            ):
+            m_begin(std::move(first)),
+            m_end(std::move(last)),
+            m_compare(compare),
+            m_prefetch(prefetch)
+        {
+            BOOST_ASSERT(std::all_of(m_begin, m_end,
+                [& compare] (const auto & range)
+                {
+                    return boost::algorithm::is_sorted(range, compare);
+                }));
+
+            remove_empty_ranges();
+            build_tree();
+        }
+
+        merge_iterator (iterator::end_tag_t, const merge_iterator & begin):
+            m_begin(begin.m_begin),
+            m_end(begin.m_begin),
+            m_compare(begin.m_compare),
+            m_prefetch(begin.m_prefetch)
+        {
+        }
+
+        merge_iterator () = default;
+
+    private:
+        friend class boost::iterator_core_access;
+
+        void remove_empty_ranges ()
+        {
+            m_end = std::remove_if(m_begin, m_end, [] (const auto & r) {return r.empty();});
+        }
+
+        std::size_t range_count () const
+        {
+            return static_cast<std::size_t>(std::distance(m_begin, m_end));
+        }
+
+        decltype(auto) range (std::size_t index) const
+        {
+            return m_begin[static_cast<outer_difference_type>(index)];
+        }
+
+        decltype(auto) front (std::size_t index, std::true_type) const
+        {
+            return m_fronts[index];
+        }
+
+        decltype(auto) front (std::size_t index, std::false_type) const
+        {
+            return range(index).front();
+        }
+
+        void cache_fronts (std::true_type)
+        {
+            m_fronts.reserve(range_count());
+            std::for_each(m_begin, m_end, [this] (const auto & r) {m_fronts.push_back(r.front());});
+        }
+
+        void cache_fronts (std::false_type)
+        {
+        }
+
+        void cache_front (std::size_t index, std::true_type)
+        {
+            m_fronts[index] = range(index).front();
+        }
+
+        void cache_front (std::size_t, std::false_type)
+        {
+        }
+
+        //!     Побеждает ли диапазон `left` диапазон `right`.
+        bool wins (std::size_t left, std::size_t right) const
+        {
+            if (left == exhausted_range)
+            {
+                return false;
+            }
+            else if (right == exhausted_range)
+            {
+                return true;
+            }
+            else
+            {
+                return m_compare(front(left, fronts_are_cached{}), front(right, fronts_are_cached{}));
+            }
+        }
+
+        void build_tree ()
+        {
+            const auto count = range_count();
+            if (count == 0)
+            {
+                return;
+            }
+
+            cache_fronts(fronts_are_cached{});
+
+            std::vector<std::size_t> winners(2 * count);
+            for (std::size_t index = 0; index < count; ++index)
+            {
+                winners[count + index] = index;
+            }
+
+            m_losers.resize(count);
+            for (auto node = count - 1; node > 0; --node)
+            {
+                const auto left = winners[2 * node];
+                const auto right = winners[2 * node + 1];
+                if (wins(right, left))
+                {
+                    winners[node] = right;
+                    m_losers[node] = left;
+                }
+                else
+                {
+                    winners[node] = left;
+                    m_losers[node] = right;
+                }
+            }
+            m_losers.front() = winners[1];
+        }
+
+        void increment ()
+        {
+            auto winner = m_losers.front();
+            auto node = (range_count() + winner) / 2;
+
+            auto && range = this->range(winner);
+            range.advance_begin(1);
+            detail::prefetch_ahead(range, m_prefetch);
+            if (not range.empty())
+            {
+                cache_front(winner, fronts_are_cached{});
+            }
+            else
+            {
+                winner = exhausted_range;
+            }
+
+            for (; node > 0; node /= 2)
+            {
+                if (wins(m_losers[node], winner))
+                {
+                    std::swap(m_losers[node], winner);
+                }
+            }
+            m_losers.front() = winner;
+        }
+
+        bool exhausted () const
+        {
+            return m_losers.empty() || m_losers.front() == exhausted_range;
+        }
+
+    private:
+        typename base_type::reference dereference () const
+        {
+            return range(m_losers.front()).front();
+        }
+
+        bool equal (const merge_iterator & that) const
+        {
+            assert(this->m_begin == that.m_begin);
+            if (this->exhausted() || that.exhausted())
+            {
+                return this->exhausted() == that.exhausted();
+            }
+            else
+            {
+                return std::equal(this->m_begin, this->m_end, that.m_begin, that.m_end);
+            }
+        }
+
+    private:
+        outer_range_iterator m_begin;
+        outer_range_iterator m_end;
+
+        Compare m_compare;
+        PrefetchPolicy m_prefetch;
+
+        std::vector<std::size_t> m_losers;
+        std::vector<cached_front_type> m_fronts;
     };
 
     //!     Функция для создания итератора слияния с предикатом.
@@ -195,16 +536,171 @@ namespace burst
             );
     }
 
+    //!     Функция для создания итератора слияния с заданным способом слияния.
+    /*!
+            Аналогична функциям создания итератора слияния, но первым аргументом принимает способ
+        слияния (см. `iterator::loser_tree_merge_t`).
+     */
+    template <typename RandomAccessIterator, typename Compare>
+    auto
+        make_merge_iterator
+        (
+            iterator::loser_tree_merge_t,
+            RandomAccessIterator first, RandomAccessIterator last,
+            Compare compare
+        )
+    {
+        using merge_iterator_type =
+            merge_iterator<RandomAccessIterator, Compare, iterator::loser_tree_merge_t>;
+        return merge_iterator_type(std::move(first), std::move(last), compare);
+    }
+
+    template <typename RandomAccessRange, typename Compare>
+    auto make_merge_iterator (iterator::loser_tree_merge_t policy, RandomAccessRange && ranges, Compare compare)
+    {
+        using std::begin;
+        using std::end;
+        return
+            make_merge_iterator
+            (
+                policy,
+                begin(std::forward<RandomAccessRange>(ranges)),
+                end(std::forward<RandomAccessRange>(ranges)),
+                compare
+            );
+    }
+
+    template <typename RandomAccessIterator>
+    auto make_merge_iterator (iterator::loser_tree_merge_t policy, RandomAccessIterator first, RandomAccessIterator last)
+    {
+        return make_merge_iterator(policy, std::move(first), std::move(last), std::less<>{});
+    }
+
+    template <typename RandomAccessRange>
+    auto make_merge_iterator (iterator::loser_tree_merge_t policy, RandomAccessRange && ranges)
+    {
+        return make_merge_iterator(policy, std::forward<RandomAccessRange>(ranges), std::less<>{});
+    }
+
+    //!     Функция для создания итератора слияния с упреждающей выборкой.
+    /*!
+            Аналогична функциям создания итератора слияния, но первым аргументом принимает
+        настройки упреждающей выборки (см. `iterator::prefetch_t`). Если перед ними передан
+        способ слияния, то используется он, иначе — слияние пирамидой.
+     */
+    template <typename RandomAccessIterator, typename Compare>
+    auto
+        make_merge_iterator
+        (
+            iterator::prefetch_t prefetch,
+            RandomAccessIterator first, RandomAccessIterator last,
+            Compare compare
+        )
+    {
+        using merge_iterator_type =
+            merge_iterator<RandomAccessIterator, Compare, iterator::heap_merge_t, iterator::prefetch_t>;
+        return merge_iterator_type(std::move(first), std::move(last), compare, prefetch);
+    }
+
+    template <typename RandomAccessRange, typename Compare>
+    auto make_merge_iterator (iterator::prefetch_t prefetch, RandomAccessRange && ranges, Compare compare)
+    {
+        using std::begin;
+        using std::end;
+        return
+            make_merge_iterator
+            (
+                prefetch,
+                begin(std::forward<RandomAccessRange>(ranges)),
+                end(std::forward<RandomAccessRange>(ranges)),
+                compare
+            );
+    }
+
+    template <typename RandomAccessIterator>
+    auto make_merge_iterator (iterator::prefetch_t prefetch, RandomAccessIterator first, RandomAccessIterator last)
+    {
+        return make_merge_iterator(prefetch, std::move(first), std::move(last), std::less<>{});
+    }
+
+    template <typename RandomAccessRange>
+    auto make_merge_iterator (iterator::prefetch_t prefetch, RandomAccessRange && ranges)
+    {
+        return make_merge_iterator(prefetch, std::forward<RandomAccessRange>(ranges), std::less<>{});
+    }
+
+    template <typename RandomAccessIterator, typename Compare>
+    auto
+        make_merge_iterator
+        (
+            iterator::loser_tree_merge_t,
+            iterator::prefetch_t prefetch,
+            RandomAccessIterator first, RandomAccessIterator last,
+            Compare compare
+        )
+    {
+        using merge_iterator_type =
+            merge_iterator<RandomAccessIterator, Compare, iterator::loser_tree_merge_t, iterator::prefetch_t>;
+        return merge_iterator_type(std::move(first), std::move(last), compare, prefetch);
+    }
+
+    template <typename RandomAccessRange, typename Compare>
+    auto
+        make_merge_iterator
+        (
+            iterator::loser_tree_merge_t policy,
+            iterator::prefetch_t prefetch,
+            RandomAccessRange && ranges,
+            Compare compare
+        )
+    {
+        using std::begin;
+        using std::end;
+        return
+            make_merge_iterator
+            (
+                policy,
+                prefetch,
+                begin(std::forward<RandomAccessRange>(ranges)),
+                end(std::forward<RandomAccessRange>(ranges)),
+                compare
+            );
+    }
+
+    template <typename RandomAccessIterator>
+    auto
+        make_merge_iterator
+        (
+            iterator::loser_tree_merge_t policy,
+            iterator::prefetch_t prefetch,
+            RandomAccessIterator first, RandomAccessIterator last
+        )
+    {
+        return make_merge_iterator(policy, prefetch, std::move(first), std::move(last), std::less<>{});
+    }
+
+    template <typename RandomAccessRange>
+    auto make_merge_iterator (iterator::loser_tree_merge_t policy, iterator::prefetch_t prefetch, RandomAccessRange && ranges)
+    {
+        return make_merge_iterator(policy, prefetch, std::forward<RandomAccessRange>(ranges), std::less<>{});
+    }
+
     //!     Функция для создания итератора на конец слияния с предикатом.
     /*!
             Принимает на вход итератор на начало сливаемых диапазонов и индикатор конца итератора.
             Возвращает итератор-конец, который, если до него дойти, покажет, что элементы слияния
         закончились.
      */
-    template <typename RandomAccessIterator, typename Compare>
-    auto make_merge_iterator (iterator::end_tag_t, const merge_iterator<RandomAccessIterator, Compare> & begin)
+    template <typename RandomAccessIterator, typename Compare, typename MergePolicy, typename PrefetchPolicy>
+    auto
+        make_merge_iterator
+        (
+            iterator::end_tag_t,
+            const merge_iterator<RandomAccessIterator, Compare, MergePolicy, PrefetchPolicy> & begin
+        )
     {
-        return merge_iterator<RandomAccessIterator, Compare>(iterator::end_tag, begin);
+        using merge_iterator_type = merge_iterator<RandomAccessIterator, Compare, MergePolicy, PrefetchPolicy>;
+        return merge_iterator_type(iterator::end_tag, begin);
     }
 } // namespace burst
 
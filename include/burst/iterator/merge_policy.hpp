@@ -0,0 +1,39 @@
+#ifndef BURST_ITERATOR_MERGE_POLICY_HPP
+#define BURST_ITERATOR_MERGE_POLICY_HPP
+
+namespace burst
+{
+    namespace iterator
+    {
+        //!     Слияние с помощью пирамиды.
+        /*!
+                Внешний диапазон переупорядочивается в пирамиду, которая восстанавливается
+            просеиванием вершины при каждом продвижении итератора. Если первые элементы
+            диапазонов можно дёшево копировать, то они кэшируются в плотном массиве размера O(k).
+            Иначе дополнительной памяти не требуется.
+                Используется по-умолчанию.
+         */
+        struct heap_merge_t {};
+
+        //!     Константа, обозначающая слияние с помощью пирамиды.
+        const heap_merge_t heap_merge{};
+
+        //!     Слияние с помощью дерева проигравших.
+        /*!
+                Над сливаемыми диапазонами строится турнирное дерево, в каждом узле которого
+            хранится номер диапазона, проигравшего в этом узле. При продвижении итератора
+            выполняется не более ceil(log(k)) сравнений — по одному на каждый узел на пути от листа
+            победителя к корню — и не перемещается ни одного диапазона.
+                Первые элементы диапазонов, если их можно дёшево копировать, хранятся в отдельном
+            плотном массиве, так что сравнения не обращаются к самим диапазонам.
+                Требует O(k) дополнительной памяти. Выгоден при слиянии большого количества
+            диапазонов.
+         */
+        struct loser_tree_merge_t {};
+
+        //!     Константа, обозначающая слияние с помощью дерева проигравших.
+        const loser_tree_merge_t loser_tree_merge{};
+    }
+}
+
+#endif // BURST_ITERATOR_MERGE_POLICY_HPP
@@ -0,0 +1,236 @@
+#ifndef BURST_ITERATOR_MERGE_REDUCE_ITERATOR_HPP
+#define BURST_ITERATOR_MERGE_REDUCE_ITERATOR_HPP
+
+#include <burst/functional/each.hpp>
+#include <burst/iterator/end_tag.hpp>
+#include <burst/iterator/merge_iterator.hpp>
+#include <burst/iterator/merge_policy.hpp>
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    //!     Итератор свёртки слияния.
+    /*!
+            Предназначен для того, чтобы "на лету" слить несколько диапазонов, упорядоченных по
+        ключу, и свернуть все элементы с одинаковым ключом в один.
+            Принимает на вход итератор слияния, элементы которого упорядочены по ключу, функцию,
+        вычисляющую ключ элемента, и функцию свёртки `reduce(accumulated, element)`, которая
+        добавляет очередной элемент к накопленному результату и возвращает новый результат.
+        Ключ накопленного результата не должен меняться в процессе свёртки.
+            Каждый элемент получившегося диапазона соответствует одному ключу и является свёрткой
+        всех элементов всех входных диапазонов, имеющих этот ключ, в порядке их слияния. Если
+        функция свёртки возвращает свой первый аргумент, то получается слияние с выбрасыванием
+        повторов.
+            Результат свёртки хранится в самом итераторе, поэтому полученный диапазон
+        неизменяем.
+
+        \tparam MergeIterator
+            Итератор слияния входных диапазонов (см. `merge_iterator`). Его отношение порядка
+            должно сравнивать элементы по ключам.
+        \tparam Key
+            Функция, вычисляющая ключ элемента.
+        \tparam Reduce
+            Функция свёртки.
+        \tparam Compare
+            Отношение строгого порядка на ключах.
+
+            Алгоритм работы.
+
+        1. Текущий элемент слияния копируется в результат, и итератор слияния продвигается.
+        2. Пока ключ текущего элемента слияния равен ключу результата, элемент сворачивается в
+           результат, и итератор слияния продвигается.
+        3. Результат выдаётся пользователю. Когда элементы слияния закончились, закончилась и
+           свёртка.
+
+            Асимптотика.
+
+            Переход к следующему элементу занимает столько шагов итератора слияния, сколько
+        входных элементов имеют очередной ключ, и на каждый из них — одно дополнительное
+        сравнение ключей.
+     */
+    template <typename MergeIterator, typename Key, typename Reduce, typename Compare = std::less<>>
+    class merge_reduce_iterator:
+        public boost::iterator_facade
+        <
+            merge_reduce_iterator<MergeIterator, Key, Reduce, Compare>,
+            typename std::iterator_traits<MergeIterator>::value_type,
+            boost::single_pass_traversal_tag,
+            const typename std::iterator_traits<MergeIterator>::value_type &
+        >
+    {
+    private:
+        using merge_iterator_type = MergeIterator;
+        using reduced_type = typename std::iterator_traits<merge_iterator_type>::value_type;
+
+        using base_type =
+            boost::iterator_facade
+            <
+                merge_reduce_iterator,
+                reduced_type,
+                boost::single_pass_traversal_tag,
+                const reduced_type &
+            >;
+
+    public:
+        merge_reduce_iterator (merge_iterator_type merged, Key key, Reduce reduce, Compare compare = Compare()):
+            m_merged(std::move(merged)),
+            m_merged_end(make_merge_iterator(iterator::end_tag, m_merged)),
+            m_key(std::move(key)),
+            m_reduce(std::move(reduce)),
+            m_compare(std::move(compare)),
+            m_value{},
+            m_exhausted(false)
+        {
+            increment();
+        }
+
+        merge_reduce_iterator (iterator::end_tag_t, const merge_reduce_iterator & begin):
+            m_merged(begin.m_merged_end),
+            m_merged_end(begin.m_merged_end),
+            m_key(begin.m_key),
+            m_reduce(begin.m_reduce),
+            m_compare(begin.m_compare),
+            m_value{},
+            m_exhausted(true)
+        {
+        }
+
+    private:
+        friend class boost::iterator_core_access;
+
+        void increment ()
+        {
+            if (m_merged == m_merged_end)
+            {
+                m_exhausted = true;
+                return;
+            }
+
+            m_value = *m_merged;
+            ++m_merged;
+            while (m_merged != m_merged_end && not m_compare(m_key(m_value), m_key(*m_merged)))
+            {
+                m_value = m_reduce(std::move(m_value), *m_merged);
+                ++m_merged;
+            }
+        }
+
+        typename base_type::reference dereference () const
+        {
+            return m_value;
+        }
+
+        bool equal (const merge_reduce_iterator & that) const
+        {
+            return this->m_exhausted == that.m_exhausted && this->m_merged == that.m_merged;
+        }
+
+    private:
+        merge_iterator_type m_merged;
+        merge_iterator_type m_merged_end;
+
+        Key m_key;
+        Reduce m_reduce;
+        Compare m_compare;
+
+        reduced_type m_value;
+        bool m_exhausted;
+    };
+
+    //!     Функция для создания итератора свёртки слияния с предикатом.
+    /*!
+            Принимает на вход набор диапазонов, упорядоченных по ключу относительно операции
+        `compare`, функцию `key`, вычисляющую ключ элемента, и функцию свёртки `reduce`.
+            Возвращает итератор на свёртку элементов с наименьшим ключом.
+     */
+    template <typename RandomAccessRange, typename Key, typename Reduce, typename Compare>
+    auto make_merge_reduce_iterator (RandomAccessRange && ranges, Key key, Reduce reduce, Compare compare)
+    {
+        auto merged = make_merge_iterator(std::forward<RandomAccessRange>(ranges), each(key) | compare);
+        return
+            merge_reduce_iterator<decltype(merged), Key, Reduce, Compare>
+            (
+                std::move(merged),
+                std::move(key),
+                std::move(reduce),
+                std::move(compare)
+            );
+    }
+
+    //!     Функция для создания итератора свёртки слияния.
+    /*!
+            Ключи сравниваются отношением "меньше".
+     */
+    template <typename RandomAccessRange, typename Key, typename Reduce>
+    auto make_merge_reduce_iterator (RandomAccessRange && ranges, Key key, Reduce reduce)
+    {
+        return
+            make_merge_reduce_iterator
+            (
+                std::forward<RandomAccessRange>(ranges),
+                std::move(key),
+                std::move(reduce),
+                std::less<>{}
+            );
+    }
+
+    //!     Функция для создания итератора свёртки слияния с заданным способом слияния.
+    /*!
+            Аналогична предыдущим, но первым аргументом принимает способ слияния (см.
+        `iterator::loser_tree_merge_t`).
+     */
+    template <typename RandomAccessRange, typename Key, typename Reduce, typename Compare>
+    auto
+        make_merge_reduce_iterator
+        (
+            iterator::loser_tree_merge_t policy,
+            RandomAccessRange && ranges,
+            Key key,
+            Reduce reduce,
+            Compare compare
+        )
+    {
+        auto merged = make_merge_iterator(policy, std::forward<RandomAccessRange>(ranges), each(key) | compare);
+        return
+            merge_reduce_iterator<decltype(merged), Key, Reduce, Compare>
+            (
+                std::move(merged),
+                std::move(key),
+                std::move(reduce),
+                std::move(compare)
+            );
+    }
+
+    template <typename RandomAccessRange, typename Key, typename Reduce>
+    auto make_merge_reduce_iterator (iterator::loser_tree_merge_t policy, RandomAccessRange && ranges, Key key, Reduce reduce)
+    {
+        return
+            make_merge_reduce_iterator
+            (
+                policy,
+                std::forward<RandomAccessRange>(ranges),
+                std::move(key),
+                std::move(reduce),
+                std::less<>{}
+            );
+    }
+
+    //!     Функция для создания итератора на конец свёртки слияния.
+    template <typename MergeIterator, typename Key, typename Reduce, typename Compare>
+    auto
+        make_merge_reduce_iterator
+        (
+            iterator::end_tag_t,
+            const merge_reduce_iterator<MergeIterator, Key, Reduce, Compare> & begin
+        )
+    {
+        return merge_reduce_iterator<MergeIterator, Key, Reduce, Compare>(iterator::end_tag, begin);
+    }
+} // namespace burst
+
+#endif // BURST_ITERATOR_MERGE_REDUCE_ITERATOR_HPP
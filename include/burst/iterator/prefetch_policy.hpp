@@ -0,0 +1,40 @@
+#ifndef BURST_ITERATOR_PREFETCH_POLICY_HPP
+#define BURST_ITERATOR_PREFETCH_POLICY_HPP
+
+#include <cstddef>
+
+namespace burst
+{
+    namespace iterator
+    {
+        //!     Без упреждающей выборки.
+        /*!
+                Продвигаемые диапазоны читаются как есть, подгрузку памяти целиком берёт на себя
+            аппаратура.
+                Используется по-умолчанию.
+         */
+        struct no_prefetch_t {};
+
+        //!     Константа, обозначающая отсутствие упреждающей выборки.
+        const no_prefetch_t no_prefetch{};
+
+        //!     Программная упреждающая выборка.
+        /*!
+                Каждый раз, когда итератор продвигает один из внутренних диапазонов, он просит
+            процессор заранее подгрузить в кэш элемент этого диапазона, отстоящий на `distance`
+            позиций от нового начала.
+                Полезна, когда диапазонов так много, что аппаратный механизм предвыборки не
+            успевает отслеживать все потоки чтения, а сами диапазоны не помещаются в кэш.
+            Подходящее расстояние зависит от машины и подбирается замерами.
+                Действует только на внутренние диапазоны произвольного доступа, элементы которых
+            лежат в памяти (разыменование итератора даёт ссылку). Для остальных диапазонов не
+            делает ничего.
+         */
+        struct prefetch_t
+        {
+            std::size_t distance;
+        };
+    }
+}
+
+#endif // BURST_ITERATOR_PREFETCH_POLICY_HPP
@@ -0,0 +1,43 @@
+#ifndef BURST_ITERATOR_SEGMENTED_ITERATOR_TRAITS_HPP
+#define BURST_ITERATOR_SEGMENTED_ITERATOR_TRAITS_HPP
+
+#include <type_traits>
+
+namespace burst
+{
+    //!     Свойства сегментированного итератора.
+    /*!
+            Сегментированный итератор — это итератор по последовательности, которая на самом деле
+        состоит из нескольких подряд идущих кусков-сегментов (например, итератор склейки). Позиция
+        такого итератора раскладывается на итератор сегмента и локальный итератор внутри сегмента.
+        Алгоритмы, которым известна эта раскладка, могут проходить каждый сегмент отдельным
+        простым циклом по локальным итераторам, не проверяя на каждом шаге, не кончился ли текущий
+        сегмент (см. `segmented_copy`, `segmented_for_each`, `segmented_accumulate`,
+        `segmented_find`).
+
+            По-умолчанию итератор не сегментирован: `is_segmented_iterator` — `std::false_type`.
+
+            Специализация для сегментированного итератора `Iterator` должна определять:
+
+        -   `is_segmented_iterator` — `std::true_type`;
+        -   `segment_iterator` — итератор по сегментам;
+        -   `local_iterator` — итератор внутри сегмента;
+        -   `segment(i)` — сегмент, которому принадлежит позиция `i`. Для итератора на конец это
+            последний сегмент;
+        -   `local(i)` — позиция `i` внутри её сегмента. Для итератора на конец это конец
+            последнего сегмента;
+        -   `begin(s)`, `end(s)` — границы сегмента `s`;
+        -   `compose(origin, s, l)` — итератор, соответствующий позиции `l` в сегменте `s`.
+            Итератор `origin` принадлежит той же последовательности и стоит не дальше искомой
+            позиции.
+
+            Для пустого диапазона `[i, i)` функции `segment` и `local` вызывать нельзя.
+     */
+    template <typename Iterator>
+    struct segmented_iterator_traits
+    {
+        using is_segmented_iterator = std::false_type;
+    };
+} // namespace burst
+
+#endif // BURST_ITERATOR_SEGMENTED_ITERATOR_TRAITS_HPP
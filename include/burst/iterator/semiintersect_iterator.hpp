@@ -1,8 +1,7 @@
 #ifndef BURST_ITERATOR_SEMIINTERSECT_ITERATOR_HPP
 #define BURST_ITERATOR_SEMIINTERSECT_ITERATOR_HPP
 
-#include <burst/container/access/front.hpp>
-#include <burst/functional/each.hpp>
+#include <burst/iterator/detail/front_heap.hpp>
 #include <burst/iterator/detail/prevent_writing.hpp>
 #include <burst/iterator/end_tag.hpp>
 #include <burst/range/skip_to_lower_bound.hpp>
@@ -11,8 +10,6 @@
 #include <boost/assert.hpp>
 #include <boost/iterator/iterator_concepts.hpp>
 #include <boost/iterator/iterator_facade.hpp>
-#include <boost/range/adaptor/transformed.hpp>
-#include <boost/range/algorithm/count.hpp>
 #include <boost/range/concepts.hpp>
 #include <boost/range/reference.hpp>
 #include <boost/range/value_type.hpp>
@@ -54,23 +51,37 @@ namespace burst
 
             Алгоритм работы.
 
-        1. Внешний диапазон переупорядочивается так, что диапазон с M-м по заданному отношению
-           порядка первым элементом всегда стоит на M-м месте, все диапазоны, которые слева от
-           M-го, меньше него по первому элементу, а все, которые справа, — не меньше.
+        1. Внешний диапазон делится на две части. Первые M - 1 диапазонов — "отстающие", а из
+           остальных строится пирамида по первому элементу, на вершине которой стоит диапазон с
+           наименьшим первым элементом — кандидат полупересечения.
+           Любой элемент, который есть не менее чем в M диапазонах, есть хотя бы в одном из
+           диапазонов пирамиды, а значит, он не меньше первого элемента кандидата. Поэтому
+           отстающие диапазоны можно сразу продвигать до кандидата.
         2. Поиск нового полупересечения.
-           а. Каждый диапазон слева от M-го продвигается так, чтобы его первый элемент был не
-              меньше первого элемента M-го диапазона.
-           б. Если диапазон закончился, то он выбрасывается из рассмотрения. Когда диапазонов
-              становится меньше, чем M, полупересечений больше нет.
-           в. Если текущий диапазон по первому элементу стал больше M-го, то внешний диапазон
-              переупорядочивается в соответствии с п.1, и весь цикл повторяется заново.
-           г. Если текущий диапазон по первому элементу равен M-му диапазону, то берётся следующий
-              диапазон, и т.д.
-           д. Когда первые M диапазонов равны по первому элементу — полупересечение найдено.
-        3. Каждый раз, когда необходимо найти следующий элемент в полупересечении, надо "вывести из
-           равновесия" набор диапазонов, продвинув ровно на один элемент вперёд первые M из них, а
-           также все диапазоны справа от M-го, равные ему по первому элементу, и поддержать
-           инвариант п.1, после чего исполнить п.2.
+           а. Каждый отстающий диапазон продвигается "скачками" так, чтобы его первый элемент был
+              не меньше первого элемента кандидата.
+           б. Если диапазон закончился, то он выбрасывается из рассмотрения, а его место среди
+              отстающих занимает кандидат. Когда диапазонов становится меньше, чем M,
+              полупересечений больше нет.
+           в. Если отстающий диапазон по первому элементу стал больше кандидата, то он меняется
+              местами с кандидатом и просеивается вниз по пирамиде, а её новая вершина становится
+              новым кандидатом. Поиск начинается заново с первого отстающего диапазона.
+           г. Когда все отстающие диапазоны равны кандидату по первому элементу — полупересечение
+              найдено.
+        3. Каждый раз, когда необходимо найти следующий элемент в полупересечении, надо продвинуть
+           ровно на один элемент вперёд все отстающие диапазоны, а также все диапазоны из
+           пирамиды, равные кандидату по первому элементу, и вернуть последние в пирамиду, после
+           чего исполнить п.2.
+
+            Если элементы диапазонов тривиально копируемы, то пирамида сравнивает не сами
+        диапазоны, а копии их первых элементов, сложенные в отдельный плотный массив (см.
+        `detail::cached_fronts`).
+
+            Асимптотика.
+
+            Переход к новому кандидату стоит O(log N) сравнений на перестроение пирамиды и O(M)
+        сравнений на проверку отстающих диапазонов, вместо O(N) на переупорядочивание всего
+        внешнего диапазона.
      */
     template
     <
@@ -125,7 +136,8 @@ namespace burst
             m_begin(std::move(first)),
             m_end(std::move(last)),
             m_min_items(min_items),
-            m_compare(compare)
+            m_compare(compare),
+            m_fronts()
         {
             BOOST_ASSERT(std::all_of(m_begin, m_end,
                 [this] (const auto & range)
@@ -134,14 +146,25 @@ namespace burst
                 }));
             BOOST_ASSERT_MSG(min_items > 0, "Невозможно получить полупересечение из нуля элементов.");
 
-            settle();
+            remove_empty_ranges();
+            if (range_count() >= m_min_items)
+            {
+                m_fronts = fronts_type(semiintersection_candidate(), heap_size());
+                detail::make_front_heap(m_fronts, heap_size(), m_compare);
+                settle();
+            }
+            else
+            {
+                scroll_to_end();
+            }
         }
 
         semiintersect_iterator (iterator::end_tag_t, const semiintersect_iterator & begin):
             m_begin(begin.m_begin),
             m_end(begin.m_begin),
             m_min_items(begin.m_min_items),
-            m_compare(begin.m_compare)
+            m_compare(begin.m_compare),
+            m_fronts()
         {
         }
 
@@ -150,54 +173,67 @@ namespace burst
     private:
         friend class boost::iterator_core_access;
 
+        using fronts_type = detail::front_cache_t<outer_range_iterator>;
+
         void remove_empty_ranges ()
         {
             m_end = std::remove_if(m_begin, m_end, [] (const auto & r) {return r.empty();});
         }
 
-        //!     Поддержать инвариант, необходимый для поиска полупересечений.
-        /*!
-                Подробно инвариант описан в п.1 алгоритма работы.
-         */
-        void maintain_invariant ()
-        {
-            std::nth_element(m_begin, semiintersection_candidate(), m_end, each(front) | m_compare);
-        }
-
         //!     Продвижение к следующему полупересечению.
         /*!
-                Продвигает все диапазоны, установленные на текущем полупересечении (то есть все
-            первые M+ диапазонов, у которых равны первые элементы), на один элемент вперёд. В
-            результате этого пересекаемые диапазоны приходят в такое состояние, что предыдущее
-            полупересечение уже недостижимо, а следующее полупересечение в общем случае ещё не
-            достигнуто.
-                Затем запускает процесс поиска нового полупересечения.
+                Продвигает все диапазоны, установленные на текущем полупересечении, на один элемент
+            вперёд. Это все отстающие диапазоны и все диапазоны пирамиды, равные кандидату по
+            первому элементу. Последние извлекаются из пирамиды и складываются в её хвост, причём
+            кандидат оказывается на последнем месте и больше не сдвигается, так что с его первым
+            элементом и сравниваются первые элементы остальных диапазонов пирамиды.
+                Затем продвинутые диапазоны пирамиды возвращаются в неё, опустевшие выбрасываются,
+            и запускается процесс поиска нового полупересечения.
          */
         void increment ()
         {
-            std::for_each(m_begin, semiintersection_end(),
-                [] (auto & range)
+            const auto candidate = semiintersection_candidate();
+            const auto advance = [] (auto & range) {range.advance_begin(1);};
+            std::for_each(m_begin, candidate, advance);
+
+            auto heap_size = this->heap_size();
+            const auto current = heap_size - 1;
+
+            auto popped = heap_size;
+            do
+            {
+                detail::pop_front_heap(m_fronts, popped, m_compare);
+                --popped;
+            }
+            while (popped != 0 && not m_compare(m_fronts.key(current), m_fronts.key(0)));
+
+            auto range = popped;
+            while (range != heap_size)
+            {
+                auto & r = candidate[static_cast<std::ptrdiff_t>(range)];
+                advance(r);
+                if (r.empty())
+                {
+                    --heap_size;
+                    m_fronts.swap(range, heap_size);
+                }
+                else
                 {
-                    range.advance_begin(1);
-                });
+                    m_fronts.refresh(range);
+                    ++range;
+                }
+            }
+            m_end = std::next(candidate, static_cast<std::ptrdiff_t>(heap_size));
 
-            settle();
-        }
+            while (popped != heap_size)
+            {
+                ++popped;
+                detail::push_front_heap(m_fronts, popped, m_compare);
+            }
 
-        //!     Устаканить диапазоны на ближайшем полупересечении.
-        /*!
-                Выбрасывает из рассмотрения пустые диапазоны, и если их осталось не меньше M, то
-            восстанавливает инвариант и запускает функцию поиска нового полупересечения.
-                Если в процессе продвижения закончилось столько диапазонов, что их стало меньше,
-            чем M, то итератор устанавливается на конец полупересечений.
-         */
-        void settle ()
-        {
-            remove_empty_ranges();
             if (range_count() >= m_min_items)
             {
-                maintain_invariant();
-                next_semiintersection();
+                settle();
             }
             else
             {
@@ -205,96 +241,81 @@ namespace burst
             }
         }
 
-        //!     Получить конец полупересечения.
-        /*!
-                Устанавливает диапазоны справа от кандидата так, что все диапазоны, равные ему по
-            первому элементу, стоят сразу за ним.
-                Возвращает итератор на первый диапазон, первый элемент которого больше первого
-            элемента кандидата.
-         */
-        outer_range_iterator semiintersection_end ()
-        {
-            auto candidate = semiintersection_candidate();
-
-            auto front_values =
-                boost::make_iterator_range(std::next(candidate), m_end)
-                    | boost::adaptors::transformed([] (const auto & range)
-                        {
-                            return range.front();
-                        });
-
-            auto last_equal_to_candidate = candidate + boost::count(front_values, candidate->front());
-            std::nth_element(candidate, last_equal_to_candidate, m_end, each(front) | m_compare);
-
-            return std::next(last_equal_to_candidate);
-        }
-
         //!     Поиск нового полупересечения.
         /*!
                 Устанавливает диапазоны на минимальном из оставшихся элементе, который есть не
             менее, чем в M из рассматриваемых диапазонов.
-                Бежит по внешнему диапазону от первого до кандидата и продвигает каждый из них так,
-            чтобы его первый элемент был не меньше первого элемента кандидата. Если в процессе
-            продвижения какой-либо из диапазонов закончился или стал больше (по первому элементу)
-            кандидата, то диапазоны переупорядочиваются, выбирается новый кандидат, и цикл
-            начинается сначала.
+                Бежит по отстающим диапазонам и продвигает каждый из них так, чтобы его первый
+            элемент был не меньше первого элемента кандидата. Если в процессе продвижения
+            какой-либо из диапазонов закончился или стал больше (по первому элементу) кандидата, то
+            выбирается новый кандидат, и цикл начинается сначала.
                 Если слишком много диапазонов закончилось, то есть их стало меньше M, то итератор
             полупересечения устанавливается на конец полупересечений.
          */
-        void next_semiintersection ()
+        void settle ()
         {
-            while (not is_end())
+            auto range = m_begin;
+            while (not is_end() && range != semiintersection_candidate())
             {
-                auto skipped_until = skip_while_less(m_begin, semiintersection_candidate());
-                if (skipped_until == semiintersection_candidate())
+                const auto & candidate_front = m_fronts.key(0);
+                if (not range->empty() && m_compare(range->front(), candidate_front))
+                {
+                    skip_to_lower_bound(*range, candidate_front, m_compare);
+                }
+
+                if (range->empty())
                 {
-                    BOOST_ASSERT(not m_compare(skipped_until->front(), semiintersection_candidate()->front()));
-                    BOOST_ASSERT(not m_compare(semiintersection_candidate()->front(), skipped_until->front()));
-                    break; // Полупересечение найдено.
+                    drop_empty_range(range);
+                    range = next_unchecked_range(range);
                 }
-                else if (skipped_until->empty())
+                else if (m_compare(candidate_front, range->front()))
                 {
-                    drop_empty_range(skipped_until);
+                    replace_candidate(range);
+                    range = next_unchecked_range(range);
                 }
-                else // Текущий диапазон больше кандидата.
+                else
                 {
-                    BOOST_ASSERT(m_compare(semiintersection_candidate()->front(), skipped_until->front()));
-                    maintain_invariant();
+                    ++range;
                 }
             }
         }
 
-        //!     Продвинуть диапазоны до кандидата.
+        //!     Отстающий диапазон, с которого нужно продолжить поиск после смены кандидата.
         /*!
-                Пытается продвинуть диапазоны [range, candidate) так, чтобы их первый элемент был
-            не меньше первого элемента диапазона candidate.
-                Если после продвижения некоторый диапазон опустевает, или его первый элемент
-            становится больше первого элемента кандидата, то процесс останавливается и возвращается
-            итератор на этот диапазон.
+                На место `range` встал прежний кандидат. Если новый кандидат равен ему по первому
+            элементу, то все уже проверенные отстающие диапазоны по-прежнему равны кандидату, и
+            поиск продолжается со следующего. Иначе все отстающие диапазоны нужно проверить
+            заново.
          */
-        outer_range_iterator skip_while_less (outer_range_iterator range, outer_range_iterator candidate)
+        outer_range_iterator next_unchecked_range (outer_range_iterator range)
         {
-            while (range != candidate)
+            if (not is_end() && not m_compare(range->front(), m_fronts.key(0)))
             {
-                if (m_compare(range->front(), candidate->front()))
-                {
-                    skip_to_lower_bound(*range, candidate->front(), m_compare);
-                    if (range->empty() || m_compare(candidate->front(), range->front()))
-                    {
-                        break;
-                    }
-                }
-
-                ++range;
+                return std::next(range);
             }
+            else
+            {
+                return m_begin;
+            }
+        }
 
-            return range;
+        //!     Сделать кандидатом следующий по старшинству диапазон пирамиды.
+        /*!
+                Отстающий диапазон, обогнавший кандидата, меняется с ним местами и просеивается
+            вниз по пирамиде.
+         */
+        void replace_candidate (outer_range_iterator range)
+        {
+            std::iter_swap(range, semiintersection_candidate());
+            m_fronts.refresh(0);
+            detail::sift_front_heap_down(m_fronts, 0, heap_size(), m_compare);
         }
 
-        //!     Выбросить из рассмотрения опустевший диапазон.
+        //!     Выбросить из рассмотрения опустевший отстающий диапазон.
         /*!
                 Если после удаления этого диапазона их по-прежнему будет достаточно для
-            полупересечения, то нужно удалить диапазон и поддержать инвариант.
+            полупересечения, то место опустевшего диапазона занимает кандидат, а его место на
+            вершине пирамиды — последний диапазон пирамиды.
                 Если же диапазонов станет меньше необходимого минимума, то итератор полупересечений
             надо сразу установить на конец полупересечений.
          */
@@ -302,10 +323,10 @@ namespace burst
         {
             if (range_count() > m_min_items)
             {
-                std::rotate(empty_range, std::next(empty_range), m_end);
+                std::iter_swap(empty_range, semiintersection_candidate());
+                m_fronts.swap(0, heap_size() - 1);
                 --m_end;
-
-                maintain_invariant();
+                detail::sift_front_heap_down(m_fronts, 0, heap_size(), m_compare);
             }
             else
             {
@@ -332,7 +353,8 @@ namespace burst
 
         //!     Итератор на кандидата полупересечения.
         /*!
-                Кандидат полупересечения — это M-й по первому элементу диапазон.
+                Кандидат полупересечения — это вершина пирамиды, то есть M-й по счёту диапазон
+            внешнего диапазона.
          */
         outer_range_iterator semiintersection_candidate ()
         {
@@ -356,11 +378,18 @@ namespace burst
             return static_cast<std::size_t>(std::distance(m_begin, m_end));
         }
 
+        //!     Количество диапазонов в пирамиде, то есть всех, кроме отстающих.
+        std::size_t heap_size () const
+        {
+            return range_count() - (m_min_items - 1);
+        }
+
     private:
         outer_range_iterator m_begin;
         outer_range_iterator m_end;
         std::size_t m_min_items;
         compare_type m_compare;
+        fronts_type m_fronts;
     };
 
     //!     Функция для создания итератора полупересечения с предикатом.
@@ -1,9 +1,9 @@
 #ifndef BURST_ITERATOR_SYMMETRIC_DIFFERENCE_ITERATOR_HPP
 #define BURST_ITERATOR_SYMMETRIC_DIFFERENCE_ITERATOR_HPP
 
-#include <burst/algorithm/select_min.hpp>
 #include <burst/container/access/front.hpp>
 #include <burst/functional/each.hpp>
+#include <burst/functional/invert.hpp>
 #include <burst/iterator/detail/prevent_writing.hpp>
 #include <burst/iterator/end_tag.hpp>
 
@@ -51,14 +51,23 @@ namespace burst
             Алгоритм работы.
 
         1.  Инвариант
-            Либо внешний диапазон пуст, либо на первых N местах (N — любое нечётное число) стоят
-            диапазоны с наименьшими первыми элементами.
-            Текущим элементом является первый элемент первого из внутренних диапазонов.
+            Либо внешний диапазон пуст, либо он делится на две части. В начале стоит пирамида
+            диапазонов по первому элементу, на вершине которой — диапазон с наименьшим первым
+            элементом. За ней стоят N диапазонов (N — любое нечётное число), извлечённые из
+            пирамиды, первые элементы которых равны между собой и не больше первого элемента
+            любого диапазона пирамиды.
+            Текущим элементом является первый элемент любого из этих N диапазонов.
         2.  Поиск следующего элемента
-            а.  Первые N диапазонов продвигаются на один элемент вперёд.
-            б.  Каждый диапазон, который закончился, выбрасывается из рассмотрения. Когда все
-                диапазоны закончились, элементов симметрической разности больше нет.
-            в.  Восстановление инварианта.
+            а.  Извлечённые диапазоны продвигаются на один элемент вперёд и возвращаются в
+                пирамиду. Каждый диапазон, который закончился, выбрасывается из рассмотрения.
+            б.  Из пирамиды извлекаются все диапазоны, первый элемент которых равен первому
+                элементу вершины. Если их чётное количество, то всё повторяется с п. а.
+            в.  Когда все диапазоны закончились, элементов симметрической разности больше нет.
+
+            Асимптотика.
+
+            На каждом шаге трогаются только те диапазоны, которые продвигаются, поэтому переход
+        через элемент, встречающийся в `m` диапазонах из `k`, стоит O(m log k) сравнений.
      */
     template
     <
@@ -111,7 +120,7 @@ namespace burst
             ):
             m_begin(std::move(first)),
             m_end(std::move(last)),
-            m_min_end(m_begin),
+            m_heap_end(m_begin),
             m_compare(compare)
         {
             BOOST_ASSERT(std::all_of(m_begin, m_end,
@@ -120,6 +129,10 @@ namespace burst
                     return boost::algorithm::is_sorted(range, m_compare);
                 }));
 
+            remove_empty_ranges();
+            std::make_heap(m_begin, m_end, each(front) | invert(m_compare));
+            m_heap_end = m_end;
+
             settle();
         }
 
@@ -130,7 +143,7 @@ namespace burst
         ):
             m_begin(begin.m_begin),
             m_end(begin.m_begin),
-            m_min_end(begin.m_begin),
+            m_heap_end(begin.m_begin),
             m_compare(begin.m_compare)
         {
         }
@@ -145,21 +158,6 @@ namespace burst
             m_end = std::remove_if(m_begin, m_end, [] (const auto & r) {return r.empty();});
         }
 
-        //!     Поддержать инвариант
-        /*!
-                Подробно инвариант описан в п.1 алгоритма работы.
-         */
-        void maintain_invariant ()
-        {
-            m_min_end = select_min(m_begin, m_end, each(front) | m_compare);
-            while (m_min_end != m_begin && std::distance(m_begin, m_min_end) % 2 == 0)
-            {
-                std::for_each(m_begin, m_min_end, [] (auto & r) {r.advance_begin(1);});
-                remove_empty_ranges();
-                m_min_end = select_min(m_begin, m_end, each(front) | m_compare);
-            }
-        }
-
         void increment ()
         {
             faze();
@@ -170,28 +168,66 @@ namespace burst
         /*!
                 Приводит диапазоны в такое состояние, что предыдущий элемент уже недостижим, а
             следующий в общем случае ещё не достигнут.
-                Продвигает диапазоны, содержащие на первом месте текущий элемент, на один элемент
-            вперёд.
+                Продвигает извлечённые из пирамиды диапазоны, содержащие на первом месте текущий
+            элемент, на один элемент вперёд, выбрасывает опустевшие, а остальные возвращает в
+            пирамиду.
          */
         void faze ()
         {
-            std::for_each(m_begin, m_min_end, [] (auto & r) {r.advance_begin(1);});
+            std::for_each(m_heap_end, m_end, [] (auto & r) {r.advance_begin(1);});
+            m_end = std::remove_if(m_heap_end, m_end, [] (const auto & r) {return r.empty();});
+
+            while (m_heap_end != m_end)
+            {
+                ++m_heap_end;
+                std::push_heap(m_begin, m_heap_end, each(front) | invert(m_compare));
+            }
         }
 
         //!     Устаканить диапазоны на ближайшем элементе симметрической разности
         /*!
-                Выбрасывает из рассмотрения пустые диапазоны и восстанавливает инвариант.
+                Извлекает из пирамиды все диапазоны с наименьшим первым элементом. Если их
+            нечётное количество, то элемент найден. Иначе все они продвигаются вперёд, и поиск
+            продолжается.
+                Когда пирамида опустела, то внешний диапазон пуст, и итератор указывает на конец
+            симметрической разности.
          */
         void settle ()
         {
-            remove_empty_ranges();
-            maintain_invariant();
+            while (m_begin != m_heap_end)
+            {
+                extract_minimums();
+                if (std::distance(m_heap_end, m_end) % 2 == 1)
+                {
+                    break;
+                }
+                faze();
+            }
+        }
+
+        //!     Извлечь из пирамиды все диапазоны с наименьшим первым элементом
+        /*!
+                Извлекаемые диапазоны складываются в хвост пирамиды, причём первый из них
+            оказывается на последнем месте и больше не сдвигается, так что с его первым элементом
+            и сравниваются первые элементы остальных.
+         */
+        void extract_minimums ()
+        {
+            const auto heap_compare = each(front) | invert(m_compare);
+
+            const auto minimum = std::prev(m_heap_end);
+            do
+            {
+                std::pop_heap(m_begin, m_heap_end, heap_compare);
+                --m_heap_end;
+            }
+            while (m_begin != m_heap_end && not m_compare(minimum->front(), m_begin->front()));
         }
 
     private:
         typename base_type::reference dereference () const
         {
-            return m_begin->front();
+            return m_heap_end->front();
         }
 
         bool equal (const symmetric_difference_iterator & that) const
@@ -203,7 +239,7 @@ namespace burst
     private:
         outer_range_iterator m_begin;
         outer_range_iterator m_end;
-        outer_range_iterator m_min_end; // Итератор на позицию за последним минимальным элементом.
+        outer_range_iterator m_heap_end; // Конец пирамиды и начало извлечённых из неё диапазонов.
         compare_type m_compare;
     };
 
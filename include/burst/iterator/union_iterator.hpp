@@ -1,8 +1,7 @@
 #ifndef BURST_ITERATOR_UNION_ITERATOR_HPP
 #define BURST_ITERATOR_UNION_ITERATOR_HPP
 
-#include <burst/container/access/front.hpp>
-#include <burst/functional/each.hpp>
+#include <burst/iterator/detail/front_heap.hpp>
 #include <burst/iterator/detail/prevent_writing.hpp>
 #include <burst/iterator/end_tag.hpp>
 
@@ -48,16 +47,27 @@ namespace burst
 
             Алгоритм работы.
 
-        1. Внешний диапазон переупорядочивается так, что его элементы (внутренние диапазоны)
-           упорядочены по первому элементу в заданном отношении порядка.
-           В каждый момент времени первый элемент первого внутреннего диапазона — текущий элемент
+        1. Из внешнего диапазона выбрасываются пустые внутренние диапазоны, а из оставшихся
+           строится пирамида по первому элементу, на вершине которой стоит диапазон с наименьшим
+           первым элементом.
+           В каждый момент времени первый элемент диапазона на вершине пирамиды — текущий элемент
            объединения.
-        2. Чтобы найти следующий элемент объединения, нужно продвинуть на один элемент вперёд все
-           внутренние диапазоны, у которых первый элемент совпадает с текущим элементом
-           объединения, а затем заново отсортировать внешний диапазон.
+        2. Чтобы найти следующий элемент объединения, нужно извлечь из пирамиды все внутренние
+           диапазоны, у которых первый элемент совпадает с текущим элементом объединения,
+           продвинуть каждый из них на один элемент вперёд и вернуть обратно в пирамиду.
+           Остальные диапазоны при этом не трогаются.
            Если в результате продвижения какой-либо из внутренних диапазонов опустел, он
            выбрасывается.
         3. Когда все внутренние диапазоны опустели, объединение закончено.
+
+            Если элементы диапазонов тривиально копируемы, то пирамида сравнивает не сами
+        диапазоны, а копии их первых элементов, сложенные в отдельный плотный массив (см.
+        `detail::cached_fronts`).
+
+            Асимптотика.
+
+            Если текущий элемент объединения встречается в `m` диапазонах из `k`, то переход к
+        следующему элементу занимает O(m log k) сравнений.
      */
     template
     <
@@ -110,7 +120,8 @@ namespace burst
             ):
             m_begin(std::move(first)),
             m_end(std::move(last)),
-            m_compare(compare)
+            m_compare(compare),
+            m_fronts()
         {
             BOOST_ASSERT(std::all_of(m_begin, m_end,
                 [this] (const auto & range)
@@ -118,13 +129,16 @@ namespace burst
                     return boost::algorithm::is_sorted(range, m_compare);
                 }));
 
-            maintain_invariant();
+            remove_empty_ranges();
+            m_fronts = fronts_type(m_begin, range_count());
+            detail::make_front_heap(m_fronts, range_count(), m_compare);
         }
 
         union_iterator (iterator::end_tag_t, const union_iterator & begin):
             m_begin(begin.m_begin),
             m_end(begin.m_begin),
-            m_compare(begin.m_compare)
+            m_compare(begin.m_compare),
+            m_fronts()
         {
         }
 
@@ -133,28 +147,60 @@ namespace burst
     private:
         friend class boost::iterator_core_access;
 
+        using fronts_type = detail::front_cache_t<outer_range_iterator>;
+
         void remove_empty_ranges ()
         {
             m_end = std::remove_if(m_begin, m_end, [] (const auto & r) {return r.empty();});
         }
 
-        void maintain_invariant ()
+        std::size_t range_count () const
         {
-            remove_empty_ranges();
-            std::sort(m_begin, m_end, each(front) | m_compare);
+            return static_cast<std::size_t>(std::distance(m_begin, m_end));
         }
 
+        //!     Продвинуть все диапазоны, первый элемент которых равен текущему элементу объединения.
+        /*!
+                Извлекаемые из пирамиды диапазоны складываются в её хвост, причём первый из них
+            оказывается на последнем месте и больше не сдвигается, так что с его первым элементом
+            и сравниваются первые элементы остальных кандидатов.
+         */
         void increment ()
         {
-            auto current_union_end =
-                std::upper_bound(m_begin, m_end, *m_begin, each(front) | m_compare);
-            std::for_each(m_begin, current_union_end,
-                [] (auto & range)
+            auto range_count = this->range_count();
+            const auto current = range_count - 1;
+
+            auto heap_size = range_count;
+            do
+            {
+                detail::pop_front_heap(m_fronts, heap_size, m_compare);
+                --heap_size;
+            }
+            while (heap_size != 0 && not m_compare(m_fronts.key(current), m_fronts.key(0)));
+
+            auto range = heap_size;
+            while (range != range_count)
+            {
+                auto & r = m_begin[static_cast<std::ptrdiff_t>(range)];
+                r.advance_begin(1);
+                if (r.empty())
+                {
+                    --range_count;
+                    m_fronts.swap(range, range_count);
+                }
+                else
                 {
-                    range.advance_begin(1);
-                });
+                    m_fronts.refresh(range);
+                    ++range;
+                }
+            }
+            m_end = std::next(m_begin, static_cast<std::ptrdiff_t>(range_count));
 
-            maintain_invariant();
+            while (heap_size != range_count)
+            {
+                ++heap_size;
+                detail::push_front_heap(m_fronts, heap_size, m_compare);
+            }
         }
 
     private:
@@ -173,6 +219,7 @@ namespace burst
         outer_range_iterator m_begin;
         outer_range_iterator m_end;
         compare_type m_compare;
+        fronts_type m_fronts;
 
     };
 
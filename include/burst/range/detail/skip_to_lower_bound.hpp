@@ -1,9 +1,13 @@
 #ifndef BURST_RANGE_DETAIL_SKIP_TO_LOWER_BOUND_HPP
 #define BURST_RANGE_DETAIL_SKIP_TO_LOWER_BOUND_HPP
 
+#include <burst/range/skip_policy.hpp>
+
 #include <boost/range/algorithm/lower_bound.hpp>
 #include <boost/range/iterator_range.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 
@@ -11,7 +15,7 @@ namespace burst
 {
     namespace detail
     {
-        //!     Продвижение диапазона произвольного доступа.
+        //!     Продвижение диапазона произвольного доступа двоичным поиском.
         /*!
                 Использует двоичный поиск для нахождения в диапазоне места, до которого нужно
             продвинуться, и сразу продвигается до этого места.
@@ -28,7 +32,7 @@ namespace burst
             void
         >
         ::type
-        skip_to_lower_bound (RandomAccessRange & range, const Value & goal, Compare compare)
+        skip_to_lower_bound (RandomAccessRange & range, const Value & goal, Compare compare, binary_skip_t)
         {
             range.advance_begin
             (
@@ -40,12 +44,69 @@ namespace burst
             );
         }
 
+        //!     Продвижение диапазона произвольного доступа скачками.
+        /*!
+                Скачет от начала диапазона, удваивая длину скачка, пока не встанет на элемент, не
+            меньший целевого, или пока не исчерпает разрешённое количество скачков, а затем
+            доискивает нужное место двоичным поиском в той части диапазона, которая осталась
+            непроверенной.
+         */
+        template <typename RandomAccessRange, typename Value, typename Compare>
+        typename std::enable_if
+        <
+            std::is_same
+            <
+                std::random_access_iterator_tag,
+                typename std::iterator_traits<typename boost::range_iterator<RandomAccessRange>::type>::iterator_category
+            >
+            ::value,
+            void
+        >
+        ::type
+        skip_to_lower_bound
+            (
+                RandomAccessRange & range,
+                const Value & goal,
+                Compare compare,
+                galloping_skip_t policy
+            )
+        {
+            auto first = range.begin();
+            auto last = range.end();
+
+            auto step = static_cast<decltype(std::distance(first, last))>(1);
+            for (std::size_t jump = 0; jump < policy.max_jumps && step < std::distance(first, last); ++jump)
+            {
+                const auto current = std::next(first, step);
+                if (compare(*current, goal))
+                {
+                    first = std::next(current);
+                    step *= 2;
+                }
+                else
+                {
+                    last = current;
+                    break;
+                }
+            }
+
+            range.advance_begin
+            (
+                std::distance
+                (
+                    range.begin(),
+                    std::lower_bound(first, last, goal, compare)
+                )
+            );
+        }
+
         //!     Продвижение любого диапазона, кроме произвольного доступа.
         /*!
                 Поэлементно двигает начало диапазона до тех пор, пока либо диапазон не закончится,
             либо его начало не встанет на то место, до которого нужно продвинуться.
+                Способ продвижения для таких диапазонов не имеет значения.
          */
-        template <typename InputRange, typename Value, typename Compare>
+        template <typename InputRange, typename Value, typename Compare, typename SkipPolicy>
         typename std::enable_if
         <
             not std::is_same
@@ -57,7 +118,7 @@ namespace burst
             void
         >
         ::type
-        skip_to_lower_bound (InputRange & range, const Value & goal, Compare compare)
+        skip_to_lower_bound (InputRange & range, const Value & goal, Compare compare, SkipPolicy)
         {
             while (not range.empty() && compare(range.front(), goal))
             {
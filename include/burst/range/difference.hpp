@@ -2,6 +2,7 @@
 #define BURST_RANGE_DIFFERENCE_HPP
 
 #include <burst/iterator/difference_iterator.hpp>
+#include <burst/iterator/difference_policy.hpp>
 #include <burst/iterator/end_tag.hpp>
 
 #include <boost/range/iterator_range.hpp>
@@ -52,6 +53,50 @@ namespace burst
 
         return boost::make_iterator_range(std::move(begin), std::move(end));
     }
+
+    //!     Функция для создания разности диапазонов с заданным способом обхода.
+    /*!
+            Аналогична предыдущим, но первым аргументом принимает способ обхода разности (см.
+        `iterator::chunked_difference_t`). При обходе кусками возвращается диапазон наибольших
+        непрерывных кусков уменьшаемого, из которых состоит разность.
+     */
+    template <typename ForwardRange1, typename ForwardRange2, typename Compare>
+    auto
+        difference
+        (
+            iterator::chunked_difference_t policy,
+            ForwardRange1 && minuend,
+            ForwardRange2 && subtrahend,
+            Compare compare
+        )
+    {
+        auto begin =
+            make_difference_iterator
+            (
+                policy,
+                std::forward<ForwardRange1>(minuend),
+                std::forward<ForwardRange2>(subtrahend),
+                compare
+            );
+        auto end = make_difference_iterator(iterator::end_tag, begin);
+
+        return boost::make_iterator_range(std::move(begin), std::move(end));
+    }
+
+    template <typename ForwardRange1, typename ForwardRange2>
+    auto difference (iterator::chunked_difference_t policy, ForwardRange1 && minuend, ForwardRange2 && subtrahend)
+    {
+        auto begin =
+            make_difference_iterator
+            (
+                policy,
+                std::forward<ForwardRange1>(minuend),
+                std::forward<ForwardRange2>(subtrahend)
+            );
+        auto end = make_difference_iterator(iterator::end_tag, begin);
+
+        return boost::make_iterator_range(std::move(begin), std::move(end));
+    }
 }
 
 #endif // BURST_RANGE_DIFFERENCE_HPP
@@ -3,6 +3,7 @@
 
 #include <burst/iterator/end_tag.hpp>
 #include <burst/iterator/intersect_iterator.hpp>
+#include <burst/iterator/prefetch_policy.hpp>
 
 #include <boost/range/iterator_range.hpp>
 
@@ -44,6 +45,29 @@ namespace burst
 
             return boost::make_iterator_range(std::move(begin), std::move(end));
         }
+
+        //!     Функция для создания диапазона пересечений с упреждающей выборкой.
+        /*!
+                Аналогична предыдущим, но первым аргументом принимает настройки упреждающей
+            выборки (см. `iterator::prefetch_t`).
+         */
+        template <typename RandomAccessRange, typename Compare>
+        auto operator () (iterator::prefetch_t prefetch, RandomAccessRange && ranges, Compare compare) const
+        {
+            auto begin = make_intersect_iterator(prefetch, std::forward<RandomAccessRange>(ranges), compare);
+            auto end = make_intersect_iterator(iterator::end_tag, begin);
+
+            return boost::make_iterator_range(std::move(begin), std::move(end));
+        }
+
+        template <typename RandomAccessRange>
+        auto operator () (iterator::prefetch_t prefetch, RandomAccessRange && ranges) const
+        {
+            auto begin = make_intersect_iterator(prefetch, std::forward<RandomAccessRange>(ranges));
+            auto end = make_intersect_iterator(iterator::end_tag, begin);
+
+            return boost::make_iterator_range(std::move(begin), std::move(end));
+        }
     };
 
     constexpr auto intersect = intersect_t{};
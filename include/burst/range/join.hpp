@@ -3,6 +3,7 @@
 
 #include <burst/iterator/end_tag.hpp>
 #include <burst/iterator/join_iterator.hpp>
+#include <burst/iterator/join_policy.hpp>
 
 #include <boost/range/iterator_range.hpp>
 
@@ -27,6 +28,21 @@ namespace burst
 
             return boost::make_iterator_range(std::move(begin), std::move(end));
         }
+
+        //!     Функция для создания склеенного диапазона с индексом размеров диапазонов.
+        /*!
+                Аналогична предыдущей, но первым аргументом принимает способ склейки (см.
+            `iterator::indexed_join_t`). Полученный диапазон — диапазон произвольного доступа, в
+            котором продвижение на n позиций занимает O(log |R|), а размер известен за O(1).
+         */
+        template <typename RandomAccessRange>
+        auto operator () (iterator::indexed_join_t policy, RandomAccessRange && ranges) const
+        {
+            auto begin = make_join_iterator(policy, std::forward<RandomAccessRange>(ranges));
+            auto end = make_join_iterator(iterator::end_tag, begin);
+
+            return boost::make_iterator_range(std::move(begin), std::move(end));
+        }
     };
 
     constexpr auto join = join_t{};
@@ -2,6 +2,8 @@
 #define BURST_RANGE_MERGE_HPP
 
 #include <burst/iterator/merge_iterator.hpp>
+#include <burst/iterator/merge_policy.hpp>
+#include <burst/iterator/prefetch_policy.hpp>
 
 #include <boost/range/iterator_range.hpp>
 
@@ -42,6 +44,83 @@ namespace burst
 
             return boost::make_iterator_range(std::move(begin), std::move(end));
         }
+
+        //!     Функция для создания диапазона слияния с заданным способом слияния.
+        /*!
+                Аналогична предыдущим, но первым аргументом принимает способ слияния (см.
+            `iterator::loser_tree_merge_t`).
+         */
+        template <typename RandomAccessRange, typename Compare>
+        auto operator () (iterator::loser_tree_merge_t policy, RandomAccessRange && ranges, Compare compare) const
+        {
+            auto begin = make_merge_iterator(policy, std::forward<RandomAccessRange>(ranges), compare);
+            auto end = make_merge_iterator(iterator::end_tag, begin);
+
+            return boost::make_iterator_range(std::move(begin), std::move(end));
+        }
+
+        template <typename RandomAccessRange>
+        auto operator () (iterator::loser_tree_merge_t policy, RandomAccessRange && ranges) const
+        {
+            auto begin = make_merge_iterator(policy, std::forward<RandomAccessRange>(ranges));
+            auto end = make_merge_iterator(iterator::end_tag, begin);
+
+            return boost::make_iterator_range(std::move(begin), std::move(end));
+        }
+
+        //!     Функция для создания диапазона слияния с упреждающей выборкой.
+        /*!
+                Аналогична предыдущим, но принимает настройки упреждающей выборки (см.
+            `iterator::prefetch_t`), перед которыми может стоять способ слияния.
+         */
+        template <typename RandomAccessRange, typename Compare>
+        auto operator () (iterator::prefetch_t prefetch, RandomAccessRange && ranges, Compare compare) const
+        {
+            auto begin = make_merge_iterator(prefetch, std::forward<RandomAccessRange>(ranges), compare);
+            auto end = make_merge_iterator(iterator::end_tag, begin);
+
+            return boost::make_iterator_range(std::move(begin), std::move(end));
+        }
+
+        template <typename RandomAccessRange>
+        auto operator () (iterator::prefetch_t prefetch, RandomAccessRange && ranges) const
+        {
+            auto begin = make_merge_iterator(prefetch, std::forward<RandomAccessRange>(ranges));
+            auto end = make_merge_iterator(iterator::end_tag, begin);
+
+            return boost::make_iterator_range(std::move(begin), std::move(end));
+        }
+
+        template <typename RandomAccessRange, typename Compare>
+        auto
+            operator ()
+            (
+                iterator::loser_tree_merge_t policy,
+                iterator::prefetch_t prefetch,
+                RandomAccessRange && ranges,
+                Compare compare
+            ) const
+        {
+            auto begin = make_merge_iterator(policy, prefetch, std::forward<RandomAccessRange>(ranges), compare);
+            auto end = make_merge_iterator(iterator::end_tag, begin);
+
+            return boost::make_iterator_range(std::move(begin), std::move(end));
+        }
+
+        template <typename RandomAccessRange>
+        auto
+            operator ()
+            (
+                iterator::loser_tree_merge_t policy,
+                iterator::prefetch_t prefetch,
+                RandomAccessRange && ranges
+            ) const
+        {
+            auto begin = make_merge_iterator(policy, prefetch, std::forward<RandomAccessRange>(ranges));
+            auto end = make_merge_iterator(iterator::end_tag, begin);
+
+            return boost::make_iterator_range(std::move(begin), std::move(end));
+        }
     };
 
     constexpr auto merge = merge_t{};
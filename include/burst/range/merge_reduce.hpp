@@ -0,0 +1,110 @@
+#ifndef BURST_RANGE_MERGE_REDUCE_HPP
+#define BURST_RANGE_MERGE_REDUCE_HPP
+
+#include <burst/iterator/end_tag.hpp>
+#include <burst/iterator/merge_policy.hpp>
+#include <burst/iterator/merge_reduce_iterator.hpp>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <utility>
+
+namespace burst
+{
+    struct merge_reduce_t
+    {
+        //!     Функция для создания диапазона свёртки слияния с предикатом.
+        /*!
+                Принимает на вход набор диапазонов, упорядоченных по ключу относительно операции
+            `compare`, функцию `key`, вычисляющую ключ элемента, и функцию свёртки
+            `reduce(accumulated, element)`.
+                Возвращает упорядоченный по ключу диапазон, в котором каждому ключу, встреченному
+            хотя бы в одном из входных диапазонов, соответствует ровно один элемент — свёртка всех
+            элементов с этим ключом.
+
+                Пример: сложение счётчиков из нескольких упорядоченных по ключу кусков.
+
+                auto counts = merge_reduce(shards, [] (const auto & p) {return p.first;},
+                    [] (auto a, const auto & b) {a.second += b.second; return a;});
+         */
+        template <typename RandomAccessRange, typename Key, typename Reduce, typename Compare>
+        auto operator () (RandomAccessRange && ranges, Key key, Reduce reduce, Compare compare) const
+        {
+            auto begin =
+                make_merge_reduce_iterator
+                (
+                    std::forward<RandomAccessRange>(ranges),
+                    std::move(key),
+                    std::move(reduce),
+                    std::move(compare)
+                );
+            auto end = make_merge_reduce_iterator(iterator::end_tag, begin);
+
+            return boost::make_iterator_range(std::move(begin), std::move(end));
+        }
+
+        //!     Функция для создания диапазона свёртки слияния.
+        /*!
+                Ключи сравниваются отношением "меньше".
+         */
+        template <typename RandomAccessRange, typename Key, typename Reduce>
+        auto operator () (RandomAccessRange && ranges, Key key, Reduce reduce) const
+        {
+            auto begin =
+                make_merge_reduce_iterator(std::forward<RandomAccessRange>(ranges), std::move(key), std::move(reduce));
+            auto end = make_merge_reduce_iterator(iterator::end_tag, begin);
+
+            return boost::make_iterator_range(std::move(begin), std::move(end));
+        }
+
+        //!     Функция для создания диапазона свёртки слияния с заданным способом слияния.
+        /*!
+                Аналогична предыдущим, но первым аргументом принимает способ слияния (см.
+            `iterator::loser_tree_merge_t`).
+         */
+        template <typename RandomAccessRange, typename Key, typename Reduce, typename Compare>
+        auto
+            operator ()
+            (
+                iterator::loser_tree_merge_t policy,
+                RandomAccessRange && ranges,
+                Key key,
+                Reduce reduce,
+                Compare compare
+            ) const
+        {
+            auto begin =
+                make_merge_reduce_iterator
+                (
+                    policy,
+                    std::forward<RandomAccessRange>(ranges),
+                    std::move(key),
+                    std::move(reduce),
+                    std::move(compare)
+                );
+            auto end = make_merge_reduce_iterator(iterator::end_tag, begin);
+
+            return boost::make_iterator_range(std::move(begin), std::move(end));
+        }
+
+        template <typename RandomAccessRange, typename Key, typename Reduce>
+        auto operator () (iterator::loser_tree_merge_t policy, RandomAccessRange && ranges, Key key, Reduce reduce) const
+        {
+            auto begin =
+                make_merge_reduce_iterator
+                (
+                    policy,
+                    std::forward<RandomAccessRange>(ranges),
+                    std::move(key),
+                    std::move(reduce)
+                );
+            auto end = make_merge_reduce_iterator(iterator::end_tag, begin);
+
+            return boost::make_iterator_range(std::move(begin), std::move(end));
+        }
+    };
+
+    constexpr auto merge_reduce = merge_reduce_t{};
+}
+
+#endif // BURST_RANGE_MERGE_REDUCE_HPP
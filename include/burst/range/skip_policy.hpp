@@ -0,0 +1,40 @@
+#ifndef BURST_RANGE_SKIP_POLICY_HPP
+#define BURST_RANGE_SKIP_POLICY_HPP
+
+#include <cstddef>
+#include <limits>
+
+namespace burst
+{
+    //!     Продвижение диапазона двоичным поиском.
+    /*!
+            Место, до которого нужно продвинуться, ищется двоичным поиском по всему оставшемуся
+        диапазону. Время продвижения — O(log N), где N — длина оставшегося диапазона, независимо
+        от того, насколько далеко нужно продвинуться.
+     */
+    struct binary_skip_t {};
+
+    //!     Константа, обозначающая продвижение двоичным поиском.
+    const binary_skip_t binary_skip{};
+
+    //!     Продвижение диапазона скачками.
+    /*!
+            Бегунок скачет от начала диапазона, удваивая длину скачка, пока не перескочит место,
+        до которого нужно продвинуться, после чего это место доискивается двоичным поиском между
+        двумя последними положениями бегунка. Время продвижения — O(log d), где d — расстояние, на
+        которое нужно продвинуться.
+            Если за `max_jumps` скачков место не найдено, то оставшаяся часть диапазона
+        просматривается обычным двоичным поиском. Так можно ограничить количество лишних сравнений
+        в случаях, когда продвигаться обычно приходится далеко.
+            Используется по-умолчанию.
+     */
+    struct galloping_skip_t
+    {
+        std::size_t max_jumps;
+    };
+
+    //!     Константа, обозначающая продвижение скачками без ограничения их количества.
+    const galloping_skip_t galloping_skip{std::numeric_limits<std::size_t>::max()};
+} // namespace burst
+
+#endif // BURST_RANGE_SKIP_POLICY_HPP
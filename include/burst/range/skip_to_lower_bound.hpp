@@ -2,6 +2,7 @@
 #define BURST_RANGE_SKIP_TO_LOWER_BOUND_HPP
 
 #include <burst/range/detail/skip_to_lower_bound.hpp>
+#include <burst/range/skip_policy.hpp>
 
 #include <boost/algorithm/cxx11/is_sorted.hpp>
 #include <boost/assert.hpp>
@@ -17,12 +18,25 @@ namespace burst
             Продвигает начало диапазона до первого элемента этого диапазона, который не меньше
         целевого элемента.
             Если в диапазоне такого элемента нет, то диапазон становится пустым.
+            Диапазон произвольного доступа продвигается способом, заданным политикой
+        ("policy"): `binary_skip` или `galloping_skip_t`.
+     */
+    template <typename Range, typename Value, typename Compare, typename SkipPolicy>
+    void skip_to_lower_bound (Range & range, const Value & goal, Compare compare, SkipPolicy policy)
+    {
+        BOOST_ASSERT(boost::algorithm::is_sorted(range, compare));
+        detail::skip_to_lower_bound(range, goal, compare, policy);
+    }
+
+    //!     "Прокрутить" диапазон до нижней границы относительно предиката.
+    /*!
+            Диапазон произвольного доступа продвигается скачками (см. `galloping_skip_t`): чем
+        ближе к началу диапазона целевой элемент, тем быстрее продвижение.
      */
     template <typename Range, typename Value, typename Compare>
     void skip_to_lower_bound (Range & range, const Value & goal, Compare compare)
     {
-        BOOST_ASSERT(boost::algorithm::is_sorted(range, compare));
-        detail::skip_to_lower_bound(range, goal, compare);
+        skip_to_lower_bound(range, goal, compare, galloping_skip);
     }
 
     //!     "Прокрутить" диапазон до нижней границы.
@@ -33,7 +47,7 @@ namespace burst
     template <typename Range, typename Value>
     void skip_to_lower_bound (Range & range, const Value & goal)
     {
-        detail::skip_to_lower_bound(range, goal, std::less<>{});
+        detail::skip_to_lower_bound(range, goal, std::less<>{}, galloping_skip);
     }
 
 }
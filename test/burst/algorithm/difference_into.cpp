@@ -0,0 +1,128 @@
+#include <burst/algorithm/difference_into.hpp>
+#include <burst/container/make_forward_list.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/range/difference.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(difference_into)
+    BOOST_AUTO_TEST_CASE(difference_with_empty_subtrahend_is_the_whole_minuend)
+    {
+        const auto minuend = burst::make_vector({1, 2, 3});
+        const auto subtrahend = std::vector<int>{};
+
+        std::vector<int> result;
+        burst::difference_into(minuend, subtrahend, std::back_inserter(result));
+
+        BOOST_CHECK(result == minuend);
+    }
+
+    BOOST_AUTO_TEST_CASE(returns_iterator_past_the_last_written_element)
+    {
+        const auto    minuend = burst::make_vector({1, 2, 3, 4, 5});
+        const auto subtrahend = burst::make_vector({   2,    4   });
+
+        std::vector<int> result(5, 0);
+        const auto result_end = burst::difference_into(minuend, subtrahend, result.begin());
+
+        const auto expected = burst::make_vector({1, 3, 5});
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            result.begin(), result_end,
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(ranges_are_considered_multisets)
+    {
+        const auto    minuend = burst::make_vector({1, 1, 1, 2, 2, 3});
+        const auto subtrahend = burst::make_vector({1,       2, 2, 3, 3});
+
+        std::vector<int> result;
+        burst::difference_into(minuend, subtrahend, std::back_inserter(result));
+
+        const auto expected = burst::make_vector({1, 1});
+        BOOST_CHECK(result == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(accepts_forward_ranges_and_custom_ordering)
+    {
+        const auto    minuend = burst::make_forward_list({9, 7, 5, 3, 1});
+        const auto subtrahend = burst::make_forward_list({8, 7, 6, 1});
+
+        std::vector<int> result;
+        burst::difference_into(minuend, subtrahend, std::back_inserter(result), std::greater<>{});
+
+        const auto expected = burst::make_vector({9, 5, 3});
+        BOOST_CHECK(result == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(writes_the_same_elements_as_lazy_difference)
+    {
+        std::mt19937 engine(42);
+        std::uniform_int_distribution<int> value(0, 1000);
+
+        for (auto subtrahend_size: {0, 1, 10, 1000, 5000})
+        {
+            std::vector<int> minuend(3000);
+            std::generate(minuend.begin(), minuend.end(), [&] {return value(engine);});
+            std::sort(minuend.begin(), minuend.end());
+            std::vector<int> subtrahend(static_cast<std::size_t>(subtrahend_size));
+            std::generate(subtrahend.begin(), subtrahend.end(), [&] {return value(engine);});
+            std::sort(subtrahend.begin(), subtrahend.end());
+
+            std::vector<int> result;
+            burst::difference_into(minuend, subtrahend, std::back_inserter(result));
+
+            const auto expected = burst::difference(minuend, subtrahend);
+            BOOST_CHECK_EQUAL_COLLECTIONS
+            (
+                result.begin(), result.end(),
+                expected.begin(), expected.end()
+            );
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_difference_writes_the_same_elements_as_serial_one)
+    {
+        std::mt19937 engine(2017);
+        std::uniform_int_distribution<int> value(0, 500);
+
+        std::vector<int> minuend(2000);
+        std::generate(minuend.begin(), minuend.end(), [&] {return value(engine);});
+        std::sort(minuend.begin(), minuend.end());
+        std::vector<int> subtrahend(700);
+        std::generate(subtrahend.begin(), subtrahend.end(), [&] {return value(engine);});
+        std::sort(subtrahend.begin(), subtrahend.end());
+
+        std::vector<int> expected;
+        burst::difference_into(minuend, subtrahend, std::back_inserter(expected));
+
+        for (auto thread_count: {1u, 2u, 3u, 8u, 1000u})
+        {
+            std::vector<int> result;
+            burst::difference_into(burst::par(thread_count), minuend, subtrahend, std::back_inserter(result));
+
+            BOOST_CHECK(result == expected);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_difference_respects_custom_order)
+    {
+        const auto    minuend = burst::make_vector({9, 7, 7, 5, 3, 1});
+        const auto subtrahend = burst::make_vector({8, 7,    5,    1});
+
+        std::vector<int> result;
+        burst::difference_into(burst::par(4), minuend, subtrahend, std::back_inserter(result), std::greater<>{});
+
+        const auto expected = burst::make_vector({9, 7, 3});
+        BOOST_CHECK(result == expected);
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,41 @@
+#include <burst/algorithm/intersect_any.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/range/make_range_vector.hpp>
+
+#include <boost/range/irange.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(intersect_any)
+    BOOST_AUTO_TEST_CASE(disjoint_ranges_do_not_intersect)
+    {
+        auto first = burst::make_vector({1, 3, 5, 7});
+        auto second = burst::make_vector({2, 4, 6, 8});
+        auto ranges = burst::make_range_vector(first, second);
+
+        BOOST_CHECK(not burst::intersect_any(ranges));
+    }
+
+    BOOST_AUTO_TEST_CASE(ranges_with_one_common_element_intersect)
+    {
+        auto first = burst::make_vector({1, 3, 5, 7});
+        auto second = burst::make_vector({2, 4, 7, 8});
+        auto third = burst::make_vector({0, 7});
+        auto ranges = burst::make_range_vector(first, second, third);
+
+        BOOST_CHECK(burst::intersect_any(ranges));
+    }
+
+    BOOST_AUTO_TEST_CASE(search_stops_at_the_first_common_element)
+    {
+        auto first = boost::irange(0, 1000);
+        auto second = boost::irange(500, 1000);
+        auto ranges = burst::make_range_vector(first, second);
+
+        BOOST_CHECK(burst::intersect_any(ranges, std::less<>{}));
+        BOOST_CHECK_EQUAL(ranges[0].front(), 500);
+        BOOST_CHECK_EQUAL(ranges[1].front(), 500);
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,75 @@
+#include <burst/algorithm/intersect_count.hpp>
+#include <burst/container/make_list.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/range/intersect.hpp>
+#include <burst/range/make_range_vector.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(intersect_count)
+    BOOST_AUTO_TEST_CASE(size_of_intersection_with_empty_range_is_zero)
+    {
+        auto first = burst::make_vector({1, 2, 3});
+        std::vector<int> second;
+        auto ranges = burst::make_range_vector(first, second);
+
+        BOOST_CHECK_EQUAL(burst::intersect_count(ranges), 0u);
+    }
+
+    BOOST_AUTO_TEST_CASE(repeating_elements_are_counted_as_many_times_as_they_are_intersected)
+    {
+        auto first = burst::make_vector({1, 1, 1, 2, 3, 3});
+        auto second = burst::make_vector({1, 1, 3, 3, 3, 4});
+        auto ranges = burst::make_range_vector(first, second);
+
+        BOOST_CHECK_EQUAL(burst::intersect_count(ranges), 4u);
+    }
+
+    BOOST_AUTO_TEST_CASE(size_of_intersection_of_several_ranges_is_the_length_of_intersection)
+    {
+        auto first = burst::make_list({'a', 'b', 'c', 'd', 'e'});
+        auto second = burst::make_list({'b', 'c', 'e', 'f'});
+        auto third = burst::make_list({'a', 'c', 'e'});
+        auto ranges = burst::make_range_vector(first, second, third);
+
+        BOOST_CHECK_EQUAL(burst::intersect_count(ranges), 2u);
+    }
+
+    BOOST_AUTO_TEST_CASE(size_of_intersection_with_custom_order_is_counted)
+    {
+        auto first = burst::make_vector({9, 7, 5, 3, 1});
+        auto second = burst::make_vector({8, 7, 6, 5, 4});
+        auto ranges = burst::make_range_vector(first, second);
+
+        BOOST_CHECK_EQUAL(burst::intersect_count(ranges, std::greater<>{}), 2u);
+    }
+
+    BOOST_AUTO_TEST_CASE(size_of_intersection_of_two_long_integer_ranges_matches_intersect)
+    {
+        std::mt19937 engine{};
+        for (auto max_value: {50u, 1000u, 100000u})
+        {
+            std::uniform_int_distribution<std::uint32_t> uniform(0, max_value);
+            std::vector<std::uint32_t> first(1000);
+            std::vector<std::uint32_t> second(300);
+            std::generate(first.begin(), first.end(), [& uniform, & engine] {return uniform(engine);});
+            std::generate(second.begin(), second.end(), [& uniform, & engine] {return uniform(engine);});
+            std::sort(first.begin(), first.end());
+            std::sort(second.begin(), second.end());
+
+            auto ranges = burst::make_range_vector(first, second);
+            const auto count = burst::intersect_count(ranges);
+
+            auto expected_ranges = burst::make_range_vector(first, second);
+            const auto expected = burst::intersect(expected_ranges);
+            BOOST_CHECK_EQUAL(count, static_cast<std::size_t>(std::distance(expected.begin(), expected.end())));
+        }
+    }
+BOOST_AUTO_TEST_SUITE_END()
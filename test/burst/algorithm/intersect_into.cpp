@@ -0,0 +1,94 @@
+#include <burst/algorithm/intersect_into.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/range/make_range_vector.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(intersect_into)
+    BOOST_AUTO_TEST_CASE(writes_intersection_of_ranges_to_output_iterator)
+    {
+        auto first = burst::make_vector({1, 2, 3, 4, 5, 6});
+        auto second = burst::make_vector({0, 2, 4, 6, 8});
+        auto third = burst::make_vector({2, 3, 6, 7});
+        auto ranges = burst::make_range_vector(first, second, third);
+
+        std::vector<int> intersection;
+        burst::intersect_into(ranges, std::back_inserter(intersection));
+
+        auto expected = {2, 6};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            intersection.begin(), intersection.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_intersection_writes_the_same_elements_as_serial_one)
+    {
+        std::mt19937 engine(2017);
+        std::uniform_int_distribution<int> value(0, 300);
+
+        std::vector<std::vector<int>> values(5);
+        for (auto & v: values)
+        {
+            v.resize(400);
+            std::generate(v.begin(), v.end(), [&] {return value(engine);});
+            std::sort(v.begin(), v.end());
+        }
+        std::vector<boost::iterator_range<std::vector<int>::const_iterator>> ranges;
+        for (const auto & v: values)
+        {
+            ranges.push_back(boost::make_iterator_range(v));
+        }
+
+        std::vector<int> expected;
+        auto serial_ranges = ranges;
+        burst::intersect_into(serial_ranges, std::back_inserter(expected));
+
+        for (auto thread_count: {1u, 2u, 3u, 8u, 1000u})
+        {
+            std::vector<int> result;
+            burst::intersect_into(burst::par(thread_count), ranges, std::back_inserter(result));
+
+            BOOST_CHECK(result == expected);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_intersection_respects_custom_order)
+    {
+        auto first = burst::make_vector({9, 7, 5, 5, 3, 1});
+        auto second = burst::make_vector({8, 7, 5, 5, 4, 1});
+        const auto ranges = burst::make_range_vector(first, second);
+
+        std::vector<int> intersection;
+        burst::intersect_into(burst::par(3), ranges, std::back_inserter(intersection), std::greater<>{});
+
+        auto expected = {7, 5, 5, 1};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            intersection.begin(), intersection.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_intersection_does_not_change_ranges)
+    {
+        auto first = burst::make_vector({1, 2, 3});
+        auto second = burst::make_vector({2, 3, 4});
+        const auto ranges = burst::make_range_vector(first, second);
+        const auto initial = ranges;
+
+        std::vector<int> intersection;
+        burst::intersect_into(burst::par(2), ranges, std::back_inserter(intersection));
+
+        BOOST_CHECK(ranges == initial);
+    }
+BOOST_AUTO_TEST_SUITE_END()
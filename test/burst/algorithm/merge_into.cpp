@@ -0,0 +1,212 @@
+#include <burst/algorithm/merge_into.hpp>
+#include <burst/container/make_list.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/range/make_range_vector.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(merge_into)
+    BOOST_AUTO_TEST_CASE(merging_empty_ranges_writes_nothing)
+    {
+        std::vector<int> first;
+        std::vector<int> second;
+        auto ranges = burst::make_range_vector(first, second);
+
+        std::vector<int> merged;
+        burst::merge_into(ranges, std::back_inserter(merged));
+
+        BOOST_CHECK(merged.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(merging_interleaving_ranges_writes_all_elements_in_order)
+    {
+        auto first = burst::make_vector({1, 4, 7, 10});
+        auto second = burst::make_vector({2, 5, 8});
+        auto third = burst::make_vector({3, 6, 9});
+        auto ranges = burst::make_range_vector(first, second, third);
+
+        std::vector<int> merged;
+        burst::merge_into(ranges, std::back_inserter(merged));
+
+        auto expected = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            merged.begin(), merged.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(merging_long_runs_writes_all_elements_in_order)
+    {
+        std::vector<std::vector<int>> values(4);
+        for (int i = 0; i < 1000; ++i)
+        {
+            values[static_cast<std::size_t>((i / 37) % 4)].push_back(i);
+        }
+        std::vector<boost::iterator_range<std::vector<int>::const_iterator>> ranges;
+        for (const auto & v: values)
+        {
+            ranges.push_back(boost::make_iterator_range(v));
+        }
+
+        std::vector<int> merged;
+        burst::merge_into(ranges, std::back_inserter(merged));
+
+        std::vector<int> expected(1000);
+        std::iota(expected.begin(), expected.end(), 0);
+        BOOST_CHECK(merged == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(returns_iterator_past_the_last_written_element)
+    {
+        auto first = burst::make_vector({5, 3, 1});
+        auto second = burst::make_vector({6, 4, 2});
+        auto ranges = burst::make_range_vector(first, second);
+
+        std::vector<int> merged(8, 0);
+        auto end = burst::merge_into(ranges, merged.begin(), std::greater<>{});
+
+        BOOST_CHECK(end == merged.begin() + 6);
+        auto expected = {6, 5, 4, 3, 2, 1, 0, 0};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            merged.begin(), merged.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(works_with_non_random_access_ranges)
+    {
+        auto first = burst::make_list({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 20});
+        auto second = burst::make_list({11, 12, 13});
+        auto ranges = burst::make_range_vector(first, second);
+
+        std::vector<int> merged;
+        burst::merge_into(ranges.begin(), ranges.end(), std::back_inserter(merged));
+
+        auto expected = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 20};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            merged.begin(), merged.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(merges_ranges_of_non_trivially_copyable_elements)
+    {
+        const std::vector<std::string> first{"a", "ccc", "eeeee"};
+        const std::vector<std::string> second{"bb", "dddd"};
+        auto ranges = burst::make_range_vector(first, second);
+
+        std::vector<std::string> merged;
+        burst::merge_into(ranges, std::back_inserter(merged));
+
+        const auto expected = {"a", "bb", "ccc", "dddd", "eeeee"};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            merged.begin(), merged.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_merge_gives_the_same_result_as_sequential_one)
+    {
+        std::vector<std::vector<int>> values(13);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            for (std::size_t j = 0; j < i * 17 % 31; ++j)
+            {
+                values[i].push_back(static_cast<int>(j * i % 7 + j / 3));
+            }
+            std::sort(values[i].begin(), values[i].end());
+        }
+        std::vector<boost::iterator_range<std::vector<int>::const_iterator>> ranges;
+        for (const auto & v: values)
+        {
+            ranges.push_back(boost::make_iterator_range(v));
+        }
+
+        auto sequential_ranges = ranges;
+        std::vector<int> expected;
+        burst::merge_into(sequential_ranges, std::back_inserter(expected));
+
+        for (auto thread_count: {1u, 2u, 3u, 8u, 1000u})
+        {
+            std::vector<int> merged(expected.size());
+            auto end = burst::merge_into(burst::par(thread_count), ranges, merged.begin());
+
+            BOOST_CHECK(end == merged.end());
+            BOOST_CHECK(merged == expected);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_merge_of_many_ranges_with_many_equal_elements_is_exact)
+    {
+        std::vector<std::vector<int>> values(300);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            for (std::size_t j = 0; j < i % 23; ++j)
+            {
+                values[i].push_back(static_cast<int>((i + j * j) % 5));
+            }
+            std::sort(values[i].begin(), values[i].end());
+        }
+        std::vector<boost::iterator_range<std::vector<int>::const_iterator>> ranges;
+        for (const auto & v: values)
+        {
+            ranges.push_back(boost::make_iterator_range(v));
+        }
+
+        auto sequential_ranges = ranges;
+        std::vector<int> expected;
+        burst::merge_into(sequential_ranges, std::back_inserter(expected));
+
+        for (auto thread_count: {2u, 7u, 64u, 5000u})
+        {
+            std::vector<int> merged(expected.size());
+            auto end = burst::merge_into(burst::par(thread_count), ranges, merged.begin());
+
+            BOOST_CHECK(end == merged.end());
+            BOOST_CHECK(merged == expected);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_merge_respects_custom_order)
+    {
+        auto first = burst::make_vector({9, 7, 5, 3, 1});
+        auto second = burst::make_vector({8, 6, 4, 2, 0});
+        auto third = burst::make_vector({5, 5, 5});
+        const auto ranges = burst::make_range_vector(first, second, third);
+
+        std::vector<int> merged(13);
+        burst::merge_into(burst::par(4), ranges, merged.begin(), std::greater<>{});
+
+        auto expected = {9, 8, 7, 6, 5, 5, 5, 5, 4, 3, 2, 1, 0};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            merged.begin(), merged.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_merge_of_empty_ranges_writes_nothing)
+    {
+        std::vector<int> first;
+        std::vector<int> second;
+        const auto ranges = burst::make_range_vector(first, second);
+
+        std::vector<int> merged;
+        auto end = burst::merge_into(burst::par(4), ranges, merged.begin());
+
+        BOOST_CHECK(end == merged.begin());
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,68 @@
+#include <burst/algorithm/segmented_accumulate.hpp>
+#include <burst/container/make_list.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/iterator/join_policy.hpp>
+#include <burst/range/join.hpp>
+#include <burst/range/make_range_vector.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(segmented_accumulate)
+    BOOST_AUTO_TEST_CASE(sums_elements_of_all_joined_ranges)
+    {
+        const auto empty = burst::make_vector<int>({});
+        const auto first = burst::make_vector({1, 2, 3});
+        const auto second = burst::make_vector({4, 5});
+        auto ranges = burst::make_range_vector(empty, first, empty, second, empty);
+
+        const auto sum = burst::segmented_accumulate(burst::join(ranges), 100);
+
+        BOOST_CHECK_EQUAL(sum, 115);
+    }
+
+    BOOST_AUTO_TEST_CASE(folds_elements_from_left_to_right_across_segments)
+    {
+        const auto first = burst::make_vector<std::string>({"a", "b"});
+        const auto second = burst::make_vector<std::string>({"c"});
+        const auto third = burst::make_vector<std::string>({"d", "e"});
+        auto ranges = burst::make_range_vector(first, second, third);
+
+        const auto folded =
+            burst::segmented_accumulate(burst::join(ranges), std::string("<"),
+                [] (const auto & a, const auto & b) {return a + b;});
+
+        BOOST_CHECK_EQUAL(folded, "<abcde");
+    }
+
+    BOOST_AUTO_TEST_CASE(folds_part_of_joined_range_that_starts_and_ends_inside_segments)
+    {
+        const auto first = burst::make_vector({1, 2, 3});
+        const auto second = burst::make_vector({4, 5});
+        const auto third = burst::make_vector({6, 7, 8});
+        auto ranges = burst::make_range_vector(first, second, third);
+        const auto joint_range = burst::join(burst::iterator::indexed_join, ranges);
+
+        const auto sum = burst::segmented_accumulate(joint_range.begin() + 2, joint_range.end() - 1, 0);
+
+        BOOST_CHECK_EQUAL(sum, 3 + 4 + 5 + 6 + 7);
+    }
+
+    BOOST_AUTO_TEST_CASE(accumulating_empty_joined_range_results_initial_value)
+    {
+        auto empty = std::vector<boost::iterator_range<std::vector<int>::iterator>>{};
+
+        BOOST_CHECK_EQUAL(burst::segmented_accumulate(burst::join(empty), 42), 42);
+    }
+
+    BOOST_AUTO_TEST_CASE(accumulates_not_segmented_range_as_is)
+    {
+        const auto list = burst::make_list({3, 1, 4});
+
+        BOOST_CHECK_EQUAL(burst::segmented_accumulate(list.begin(), list.end(), 1, std::multiplies<>{}), 12);
+    }
+BOOST_AUTO_TEST_SUITE_END()
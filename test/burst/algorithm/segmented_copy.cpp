@@ -0,0 +1,87 @@
+#include <burst/algorithm/segmented_copy.hpp>
+#include <burst/container/make_list.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/iterator/join_policy.hpp>
+#include <burst/range/join.hpp>
+#include <burst/range/make_range_vector.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <iterator>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(segmented_copy)
+    BOOST_AUTO_TEST_CASE(copies_joined_ranges_one_after_another_skipping_empty_ones)
+    {
+        const auto empty = burst::make_vector<int>({});
+        const auto first = burst::make_vector({1, 2, 3});
+        const auto second = burst::make_vector({4, 5});
+        auto ranges = burst::make_range_vector(empty, first, empty, second, empty);
+
+        std::vector<int> result;
+        burst::segmented_copy(burst::join(ranges), std::back_inserter(result));
+
+        BOOST_CHECK(result == burst::make_vector({1, 2, 3, 4, 5}));
+    }
+
+    BOOST_AUTO_TEST_CASE(copies_part_of_joined_range_that_starts_and_ends_inside_segments)
+    {
+        const auto first = burst::make_vector({1, 2, 3});
+        const auto second = burst::make_vector({4, 5});
+        const auto third = burst::make_vector({6, 7, 8});
+        auto ranges = burst::make_range_vector(first, second, third);
+        const auto joint_range = burst::join(ranges);
+
+        std::vector<int> result;
+        burst::segmented_copy(joint_range.begin() + 1, joint_range.begin() + 7, std::back_inserter(result));
+
+        BOOST_CHECK(result == burst::make_vector({2, 3, 4, 5, 6, 7}));
+    }
+
+    BOOST_AUTO_TEST_CASE(copies_part_of_one_segment)
+    {
+        const auto first = burst::make_vector({1, 2, 3, 4});
+        const auto second = burst::make_vector({5, 6});
+        auto ranges = burst::make_range_vector(first, second);
+        const auto joint_range = burst::join(ranges);
+
+        std::vector<int> result;
+        burst::segmented_copy(joint_range.begin() + 1, joint_range.begin() + 3, std::back_inserter(result));
+
+        BOOST_CHECK(result == burst::make_vector({2, 3}));
+    }
+
+    BOOST_AUTO_TEST_CASE(returns_iterator_past_the_last_written_element)
+    {
+        const auto first = burst::make_vector({1, 2});
+        const auto second = burst::make_vector({3});
+        auto ranges = burst::make_range_vector(first, second);
+
+        std::vector<int> result(5, 0);
+        const auto result_end = burst::segmented_copy(burst::join(burst::iterator::indexed_join, ranges), result.begin());
+
+        BOOST_CHECK(result_end == result.begin() + 3);
+        BOOST_CHECK(result == burst::make_vector({1, 2, 3, 0, 0}));
+    }
+
+    BOOST_AUTO_TEST_CASE(copying_empty_joined_range_writes_nothing)
+    {
+        auto empty = std::vector<boost::iterator_range<std::vector<int>::iterator>>{};
+
+        std::vector<int> result;
+        burst::segmented_copy(burst::join(empty), std::back_inserter(result));
+
+        BOOST_CHECK(result.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(copies_not_segmented_range_as_is)
+    {
+        const auto list = burst::make_list({3, 1, 4, 1, 5});
+
+        std::vector<int> result;
+        burst::segmented_copy(list, std::back_inserter(result));
+
+        BOOST_CHECK(result == burst::make_vector({3, 1, 4, 1, 5}));
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,93 @@
+#include <burst/algorithm/segmented_find.hpp>
+#include <burst/container/make_list.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/iterator/join_policy.hpp>
+#include <burst/range/join.hpp>
+#include <burst/range/make_range_vector.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(segmented_find)
+    BOOST_AUTO_TEST_CASE(finds_first_occurrence_of_value_in_joined_range)
+    {
+        const auto first = burst::make_vector({1, 2, 3});
+        const auto empty = burst::make_vector<int>({});
+        const auto second = burst::make_vector({4, 5, 4});
+        auto ranges = burst::make_range_vector(first, empty, second);
+        const auto joint_range = burst::join(ranges);
+
+        const auto found = burst::segmented_find(joint_range, 4);
+
+        BOOST_CHECK(found == joint_range.begin() + 3);
+        BOOST_CHECK_EQUAL(std::distance(found, joint_range.end()), 3);
+    }
+
+    BOOST_AUTO_TEST_CASE(returns_last_if_value_is_not_found)
+    {
+        const auto first = burst::make_vector({1, 2, 3});
+        const auto second = burst::make_vector({4, 5});
+        auto ranges = burst::make_range_vector(first, second);
+        const auto joint_range = burst::join(ranges);
+
+        BOOST_CHECK(burst::segmented_find(joint_range, 6) == joint_range.end());
+        BOOST_CHECK(burst::segmented_find(joint_range.begin(), joint_range.begin() + 4, 5) == joint_range.begin() + 4);
+    }
+
+    BOOST_AUTO_TEST_CASE(searches_from_the_middle_of_a_segment)
+    {
+        const auto first = burst::make_vector({7, 1, 7});
+        const auto second = burst::make_vector({2, 7});
+        auto ranges = burst::make_range_vector(first, second);
+        const auto joint_range = burst::join(ranges);
+
+        const auto found = burst::segmented_find(joint_range.begin() + 1, joint_range.end(), 7);
+
+        BOOST_CHECK(found == joint_range.begin() + 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(found_iterator_can_be_used_to_continue_traversal)
+    {
+        const auto first = burst::make_vector({1, 2});
+        const auto second = burst::make_vector({3, 4});
+        const auto empty = burst::make_vector<int>({});
+        const auto third = burst::make_vector({5});
+        auto ranges = burst::make_range_vector(first, second, empty, third);
+        const auto joint_range = burst::join(ranges);
+
+        const auto found = burst::segmented_find(joint_range, 4);
+
+        BOOST_REQUIRE(found != joint_range.end());
+        BOOST_CHECK_EQUAL(*std::next(found), 5);
+        BOOST_CHECK(std::next(found, 2) == joint_range.end());
+        BOOST_CHECK_EQUAL(*std::prev(found, 2), 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(finds_value_in_indexed_joined_range)
+    {
+        const auto first = burst::make_vector({1, 2, 3});
+        const auto second = burst::make_vector({4, 5});
+        const auto third = burst::make_vector({6, 7, 8});
+        auto ranges = burst::make_range_vector(first, second, third);
+        const auto joint_range = burst::join(burst::iterator::indexed_join, ranges);
+
+        for (auto value = 0; value <= 9; ++value)
+        {
+            BOOST_CHECK(
+                burst::segmented_find(joint_range, value) ==
+                std::find(joint_range.begin(), joint_range.end(), value));
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(searches_not_segmented_range_as_is)
+    {
+        const auto list = burst::make_list({3, 1, 4});
+
+        const auto found = burst::segmented_find(list, 1);
+
+        BOOST_CHECK(found == std::next(list.begin()));
+    }
+BOOST_AUTO_TEST_SUITE_END()
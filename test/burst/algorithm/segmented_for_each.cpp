@@ -0,0 +1,73 @@
+#include <burst/algorithm/segmented_for_each.hpp>
+#include <burst/container/make_forward_list.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/iterator/join_policy.hpp>
+#include <burst/range/join.hpp>
+#include <burst/range/make_range_vector.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(segmented_for_each)
+    BOOST_AUTO_TEST_CASE(visits_elements_of_joined_ranges_in_order)
+    {
+        const auto empty = burst::make_vector<int>({});
+        const auto first = burst::make_vector({1, 2, 3});
+        const auto second = burst::make_vector({4, 5});
+        auto ranges = burst::make_range_vector(first, empty, second);
+
+        std::vector<int> visited;
+        burst::segmented_for_each(burst::join(ranges), [& visited] (int x) {visited.push_back(x);});
+
+        BOOST_CHECK(visited == burst::make_vector({1, 2, 3, 4, 5}));
+    }
+
+    BOOST_AUTO_TEST_CASE(returned_function_keeps_state_gathered_over_all_segments)
+    {
+        const auto first = burst::make_vector({1, 2, 3});
+        const auto second = burst::make_vector({4, 5});
+        const auto third = burst::make_vector({6});
+        auto ranges = burst::make_range_vector(first, second, third);
+
+        struct counter_t
+        {
+            void operator () (int x)
+            {
+                sum += x;
+                ++count;
+            }
+
+            int sum;
+            int count;
+        };
+
+        const auto counter = burst::segmented_for_each(burst::join(ranges), counter_t{0, 0});
+
+        BOOST_CHECK_EQUAL(counter.sum, 21);
+        BOOST_CHECK_EQUAL(counter.count, 6);
+    }
+
+    BOOST_AUTO_TEST_CASE(may_modify_elements_of_joined_ranges)
+    {
+        auto first = burst::make_vector({1, 2, 3});
+        auto second = burst::make_vector({4, 5});
+        auto ranges = burst::make_range_vector(first, second);
+        const auto joint_range = burst::join(burst::iterator::indexed_join, ranges);
+
+        burst::segmented_for_each(joint_range.begin() + 2, joint_range.end(), [] (int & x) {x *= 10;});
+
+        BOOST_CHECK(first == burst::make_vector({1, 2, 30}));
+        BOOST_CHECK(second == burst::make_vector({40, 50}));
+    }
+
+    BOOST_AUTO_TEST_CASE(visits_not_segmented_range_as_is)
+    {
+        const auto list = burst::make_forward_list({3, 1, 4});
+
+        std::vector<int> visited;
+        burst::segmented_for_each(list, [& visited] (int x) {visited.push_back(x);});
+
+        BOOST_CHECK(visited == burst::make_vector({3, 1, 4}));
+    }
+BOOST_AUTO_TEST_SUITE_END()
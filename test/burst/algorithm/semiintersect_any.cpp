@@ -0,0 +1,48 @@
+#include <burst/algorithm/semiintersect_any.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/range/make_range_vector.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(semiintersect_any)
+    BOOST_AUTO_TEST_CASE(pairwise_disjoint_ranges_have_no_semiintersection_over_two_ranges)
+    {
+        auto first = burst::make_vector({1, 4});
+        auto second = burst::make_vector({2, 5});
+        auto third = burst::make_vector({3, 6});
+        auto ranges = burst::make_range_vector(first, second, third);
+
+        BOOST_CHECK(not burst::semiintersect_any(ranges, 2));
+    }
+
+    BOOST_AUTO_TEST_CASE(element_present_in_enough_ranges_makes_semiintersection_non_empty)
+    {
+        auto first = burst::make_vector({1, 4});
+        auto second = burst::make_vector({2, 4});
+        auto third = burst::make_vector({3, 6});
+        auto ranges = burst::make_range_vector(first, second, third);
+
+        BOOST_CHECK(burst::semiintersect_any(ranges, 2, std::less<>{}));
+    }
+
+    BOOST_AUTO_TEST_CASE(semiintersection_over_one_range_is_non_empty_if_any_range_is_non_empty)
+    {
+        std::vector<int> first;
+        auto second = burst::make_vector({2});
+        auto ranges = burst::make_range_vector(first, second);
+
+        BOOST_CHECK(burst::semiintersect_any(ranges, 1));
+    }
+
+    BOOST_AUTO_TEST_CASE(semiintersection_over_more_ranges_than_there_are_is_empty)
+    {
+        auto first = burst::make_vector({1});
+        auto second = burst::make_vector({1});
+        auto ranges = burst::make_range_vector(first, second);
+
+        BOOST_CHECK(not burst::semiintersect_any(ranges, 3));
+    }
+BOOST_AUTO_TEST_SUITE_END()
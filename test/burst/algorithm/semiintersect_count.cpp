@@ -0,0 +1,57 @@
+#include <burst/algorithm/semiintersect_count.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/range/make_range_vector.hpp>
+#include <burst/range/semiintersect.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(semiintersect_count)
+    BOOST_AUTO_TEST_CASE(size_of_semiintersection_over_more_ranges_than_there_are_is_zero)
+    {
+        auto first = burst::make_vector({1, 2, 3});
+        auto second = burst::make_vector({1, 2, 3});
+        auto ranges = burst::make_range_vector(first, second);
+
+        BOOST_CHECK_EQUAL(burst::semiintersect_count(ranges, 3), 0u);
+    }
+
+    BOOST_AUTO_TEST_CASE(size_of_semiintersection_is_the_length_of_semiintersection)
+    {
+        auto first = burst::make_vector({1, 2, 3, 5});
+        auto second = burst::make_vector({2, 3, 4});
+        auto third = burst::make_vector({3, 4, 5});
+        auto fourth = burst::make_vector({0, 6});
+        auto ranges = burst::make_range_vector(first, second, third, fourth);
+
+        BOOST_CHECK_EQUAL(burst::semiintersect_count(ranges, 2, std::less<>{}), 4u);
+    }
+
+    BOOST_AUTO_TEST_CASE(size_of_semiintersection_of_random_ranges_matches_semiintersect)
+    {
+        std::mt19937 engine{};
+        std::uniform_int_distribution<int> uniform(0, 200);
+        for (std::size_t min_items = 1; min_items <= 4; ++min_items)
+        {
+            std::vector<std::vector<int>> values(4, std::vector<int>(100));
+            for (auto & v: values)
+            {
+                std::generate(v.begin(), v.end(), [& uniform, & engine] {return uniform(engine);});
+                std::sort(v.begin(), v.end());
+            }
+
+            auto ranges = burst::make_range_vector(values[0], values[1], values[2], values[3]);
+            const auto count = burst::semiintersect_count(ranges, min_items);
+
+            auto expected_ranges = burst::make_range_vector(values[0], values[1], values[2], values[3]);
+            const auto expected = burst::semiintersect(expected_ranges, min_items);
+            BOOST_CHECK_EQUAL(count, static_cast<std::size_t>(std::distance(expected.begin(), expected.end())));
+        }
+    }
+BOOST_AUTO_TEST_SUITE_END()
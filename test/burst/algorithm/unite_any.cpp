@@ -0,0 +1,28 @@
+#include <burst/algorithm/unite_any.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/range/make_range_vector.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(unite_any)
+    BOOST_AUTO_TEST_CASE(union_of_empty_ranges_is_empty)
+    {
+        std::vector<int> first;
+        std::vector<int> second;
+        auto ranges = burst::make_range_vector(first, second);
+
+        BOOST_CHECK(not burst::unite_any(ranges));
+    }
+
+    BOOST_AUTO_TEST_CASE(union_with_at_least_one_non_empty_range_is_not_empty)
+    {
+        std::vector<int> first;
+        auto second = burst::make_vector({3});
+        auto ranges = burst::make_range_vector(first, second);
+
+        BOOST_CHECK(burst::unite_any(ranges, std::less<>{}));
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,66 @@
+#include <burst/algorithm/unite_count.hpp>
+#include <burst/container/make_list.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/range/make_range_vector.hpp>
+#include <burst/range/unite.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(unite_count)
+    BOOST_AUTO_TEST_CASE(size_of_union_of_empty_ranges_is_zero)
+    {
+        std::vector<int> first;
+        std::vector<int> second;
+        auto ranges = burst::make_range_vector(first, second);
+
+        BOOST_CHECK_EQUAL(burst::unite_count(ranges), 0u);
+    }
+
+    BOOST_AUTO_TEST_CASE(repeating_elements_are_counted_as_many_times_as_in_the_range_where_they_occur_most)
+    {
+        auto first = burst::make_vector({1, 1, 1, 2, 3});
+        auto second = burst::make_vector({1, 3, 3, 4});
+        auto ranges = burst::make_range_vector(first, second);
+
+        BOOST_CHECK_EQUAL(burst::unite_count(ranges), 7u);
+    }
+
+    BOOST_AUTO_TEST_CASE(size_of_union_of_several_ranges_is_the_length_of_union)
+    {
+        auto first = burst::make_list({'a', 'c'});
+        auto second = burst::make_list({'b', 'c', 'd'});
+        auto third = burst::make_list({'d', 'e'});
+        auto ranges = burst::make_range_vector(first, second, third);
+
+        BOOST_CHECK_EQUAL(burst::unite_count(ranges, std::less<>{}), 5u);
+    }
+
+    BOOST_AUTO_TEST_CASE(size_of_union_of_two_long_integer_ranges_matches_unite)
+    {
+        std::mt19937 engine{};
+        for (auto max_value: {50u, 1000u, 100000u})
+        {
+            std::uniform_int_distribution<std::uint64_t> uniform(0, max_value);
+            std::vector<std::uint64_t> first(700);
+            std::vector<std::uint64_t> second(900);
+            std::generate(first.begin(), first.end(), [& uniform, & engine] {return uniform(engine);});
+            std::generate(second.begin(), second.end(), [& uniform, & engine] {return uniform(engine);});
+            std::sort(first.begin(), first.end());
+            std::sort(second.begin(), second.end());
+
+            auto ranges = burst::make_range_vector(first, second);
+            const auto count = burst::unite_count(ranges);
+
+            auto expected_ranges = burst::make_range_vector(first, second);
+            const auto expected = burst::unite(expected_ranges);
+            BOOST_CHECK_EQUAL(count, static_cast<std::size_t>(std::distance(expected.begin(), expected.end())));
+        }
+    }
+BOOST_AUTO_TEST_SUITE_END()
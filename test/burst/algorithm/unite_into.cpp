@@ -0,0 +1,75 @@
+#include <burst/algorithm/unite_into.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/range/make_range_vector.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(unite_into)
+    BOOST_AUTO_TEST_CASE(writes_union_of_ranges_to_output_iterator)
+    {
+        auto first = burst::make_vector({1, 1, 3, 5});
+        auto second = burst::make_vector({1, 2, 3});
+        auto ranges = burst::make_range_vector(first, second);
+
+        std::vector<int> united;
+        burst::unite_into(ranges, std::back_inserter(united));
+
+        auto expected = {1, 1, 2, 3, 5};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            united.begin(), united.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_union_writes_the_same_elements_as_serial_one)
+    {
+        std::mt19937 engine(2017);
+        std::uniform_int_distribution<int> value(0, 300);
+
+        std::vector<std::vector<int>> values(5);
+        for (auto & v: values)
+        {
+            v.resize(400);
+            std::generate(v.begin(), v.end(), [&] {return value(engine);});
+            std::sort(v.begin(), v.end());
+        }
+        std::vector<boost::iterator_range<std::vector<int>::const_iterator>> ranges;
+        for (const auto & v: values)
+        {
+            ranges.push_back(boost::make_iterator_range(v));
+        }
+
+        std::vector<int> expected;
+        auto serial_ranges = ranges;
+        burst::unite_into(serial_ranges, std::back_inserter(expected));
+
+        for (auto thread_count: {1u, 2u, 3u, 8u, 1000u})
+        {
+            std::vector<int> result;
+            burst::unite_into(burst::par(thread_count), ranges, std::back_inserter(result));
+
+            BOOST_CHECK(result == expected);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_union_of_empty_ranges_writes_nothing)
+    {
+        std::vector<int> first;
+        std::vector<int> second;
+        const auto ranges = burst::make_range_vector(first, second);
+
+        std::vector<int> united;
+        burst::unite_into(burst::par(4), ranges, std::back_inserter(united), std::less<>{});
+
+        BOOST_CHECK(united.empty());
+    }
+BOOST_AUTO_TEST_SUITE_END()
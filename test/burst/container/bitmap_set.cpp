@@ -0,0 +1,179 @@
+#include <burst/container/bitmap_set.hpp>
+#include <burst/range/difference.hpp>
+#include <burst/range/intersect.hpp>
+#include <burst/range/make_range_vector.hpp>
+#include <burst/range/skip_to_lower_bound.hpp>
+#include <burst/range/symmetric_difference.hpp>
+#include <burst/range/unite.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace
+{
+    std::vector<unsigned> generate_dense_set (std::size_t universe, double density, std::mt19937 & engine)
+    {
+        std::bernoulli_distribution is_present(density);
+
+        std::vector<unsigned> values;
+        for (auto value = 0u; value < universe; ++value)
+        {
+            if (is_present(engine))
+            {
+                values.push_back(value);
+            }
+        }
+        return values;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(bitmap_set)
+    BOOST_AUTO_TEST_CASE(bitmap_set_initialized_with_default_constructor_is_empty)
+    {
+        burst::bitmap_set<unsigned> set;
+        BOOST_CHECK(set.empty());
+        BOOST_CHECK_EQUAL(set.size(), 0);
+        BOOST_CHECK(set.begin() == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(iterates_over_ordered_distinct_elements)
+    {
+        burst::bitmap_set<int> set(200, {130, 5, 64, 0, 5, 63, 199});
+
+        const auto expected = {0, 5, 63, 64, 130, 199};
+        BOOST_CHECK_EQUAL(set.size(), expected.size());
+        BOOST_CHECK_EQUAL_COLLECTIONS(set.begin(), set.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(insert_and_erase_report_whether_set_has_changed)
+    {
+        burst::bitmap_set<unsigned> set(100);
+
+        BOOST_CHECK(set.insert(42));
+        BOOST_CHECK(not set.insert(42));
+        BOOST_CHECK(set.contains(42));
+        BOOST_CHECK_EQUAL(set.size(), 1);
+
+        BOOST_CHECK_EQUAL(set.erase(42), 1);
+        BOOST_CHECK_EQUAL(set.erase(42), 0);
+        BOOST_CHECK(not set.contains(42));
+        BOOST_CHECK(set.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(word_operations_give_the_same_sets_as_standard_algorithms)
+    {
+        std::mt19937 engine(2017);
+        const auto universe = std::size_t{5000};
+        const auto left_values = generate_dense_set(universe, 0.3, engine);
+        const auto right_values = generate_dense_set(universe, 0.5, engine);
+
+        const auto left = burst::bitmap_set<unsigned>(universe, left_values.begin(), left_values.end());
+        const auto right = burst::bitmap_set<unsigned>(universe, right_values.begin(), right_values.end());
+
+        std::vector<unsigned> expected;
+        std::set_intersection(left_values.begin(), left_values.end(), right_values.begin(), right_values.end(),
+            std::back_inserter(expected));
+        const auto intersection = left & right;
+        BOOST_CHECK_EQUAL_COLLECTIONS(intersection.begin(), intersection.end(), expected.begin(), expected.end());
+        BOOST_CHECK_EQUAL(intersection.size(), expected.size());
+        BOOST_CHECK_EQUAL(burst::intersection_size(left, right), expected.size());
+
+        expected.clear();
+        std::set_union(left_values.begin(), left_values.end(), right_values.begin(), right_values.end(),
+            std::back_inserter(expected));
+        const auto united = left | right;
+        BOOST_CHECK_EQUAL_COLLECTIONS(united.begin(), united.end(), expected.begin(), expected.end());
+        BOOST_CHECK_EQUAL(burst::union_size(left, right), expected.size());
+
+        expected.clear();
+        std::set_difference(left_values.begin(), left_values.end(), right_values.begin(), right_values.end(),
+            std::back_inserter(expected));
+        const auto difference = left - right;
+        BOOST_CHECK_EQUAL_COLLECTIONS(difference.begin(), difference.end(), expected.begin(), expected.end());
+        BOOST_CHECK_EQUAL(burst::difference_size(left, right), expected.size());
+
+        expected.clear();
+        std::set_symmetric_difference(left_values.begin(), left_values.end(), right_values.begin(), right_values.end(),
+            std::back_inserter(expected));
+        const auto symmetric_difference = left ^ right;
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            symmetric_difference.begin(), symmetric_difference.end(),
+            expected.begin(), expected.end()
+        );
+        BOOST_CHECK_EQUAL(burst::symmetric_difference_size(left, right), expected.size());
+    }
+
+    BOOST_AUTO_TEST_CASE(skip_to_lower_bound_stops_at_the_same_element_as_on_plain_array)
+    {
+        std::mt19937 engine(2017);
+        const auto universe = std::size_t{3000};
+        const auto values = generate_dense_set(universe, 0.05, engine);
+        const auto set = burst::bitmap_set<unsigned>(universe, values.begin(), values.end());
+
+        std::uniform_int_distribution<std::size_t> position(0, values.size() - 1);
+        std::uniform_int_distribution<unsigned> goal(0, static_cast<unsigned>(universe + 100));
+        for (auto attempt = 0; attempt < 500; ++attempt)
+        {
+            const auto start = static_cast<std::ptrdiff_t>(position(engine));
+            const auto stop = std::max(start, static_cast<std::ptrdiff_t>(position(engine)));
+
+            auto bitmap = boost::make_iterator_range(std::next(set.begin(), start), std::next(set.begin(), stop));
+            auto plain = boost::make_iterator_range(values.begin() + start, values.begin() + stop);
+
+            const auto target = goal(engine);
+            using burst::skip_to_lower_bound;
+            skip_to_lower_bound(bitmap, target);
+            skip_to_lower_bound(plain, target);
+
+            BOOST_CHECK_EQUAL_COLLECTIONS(bitmap.begin(), bitmap.end(), plain.begin(), plain.end());
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(bitmap_ranges_are_accepted_by_set_operation_iterators)
+    {
+        std::mt19937 engine(2017);
+        const auto universe = std::size_t{2000};
+        const auto left_values = generate_dense_set(universe, 0.2, engine);
+        const auto right_values = generate_dense_set(universe, 0.4, engine);
+        const auto left = burst::bitmap_set<unsigned>(universe, left_values.begin(), left_values.end());
+        const auto right = burst::bitmap_set<unsigned>(universe, right_values.begin(), right_values.end());
+
+        auto ranges = burst::make_range_vector(left, right);
+        const auto intersection = burst::intersect(ranges);
+        const auto expected_intersection = left & right;
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            intersection.begin(), intersection.end(),
+            expected_intersection.begin(), expected_intersection.end()
+        );
+
+        ranges = burst::make_range_vector(left, right);
+        const auto united = burst::unite(ranges);
+        const auto expected_union = left | right;
+        BOOST_CHECK_EQUAL_COLLECTIONS(united.begin(), united.end(), expected_union.begin(), expected_union.end());
+
+        ranges = burst::make_range_vector(left, right);
+        const auto symmetric_difference = burst::symmetric_difference(ranges);
+        const auto expected_symmetric_difference = left ^ right;
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            symmetric_difference.begin(), symmetric_difference.end(),
+            expected_symmetric_difference.begin(), expected_symmetric_difference.end()
+        );
+
+        const auto difference = burst::difference(left, right);
+        const auto expected_difference = left - right;
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference.begin(), difference.end(),
+            expected_difference.begin(), expected_difference.end()
+        );
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,135 @@
+#include <burst/container/compressed_k_ary_search_set.hpp>
+#include <burst/container/k_ary_search_set.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <set>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(compressed_k_ary_search_set)
+    BOOST_AUTO_TEST_CASE(compressed_k_ary_search_set_initialized_with_default_constructor_is_empty)
+    {
+        burst::compressed_k_ary_search_set<int> set;
+        BOOST_CHECK(set.empty());
+        BOOST_CHECK_EQUAL(set.size(), 0);
+        BOOST_CHECK(not set.contains(0));
+    }
+
+    BOOST_AUTO_TEST_CASE(contains_exactly_elements_of_initial_range)
+    {
+        auto numbers = burst::make_vector({30, 4, 6, 1, 7, 18, 2, 5});
+
+        burst::compressed_k_ary_search_set<int> set(numbers.begin(), numbers.end(), 3);
+
+        BOOST_CHECK_EQUAL(set.size(), numbers.size());
+        for (auto x = -5; x < 40; ++x)
+        {
+            BOOST_CHECK_EQUAL(set.contains(x), std::count(numbers.begin(), numbers.end(), x) == 1);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(duplicates_are_stored_once)
+    {
+        burst::compressed_k_ary_search_set<unsigned> set({5, 3, 5, 1, 3}, 3);
+
+        BOOST_CHECK_EQUAL(set.size(), 3);
+        BOOST_CHECK(set.contains(1));
+        BOOST_CHECK(set.contains(3));
+        BOOST_CHECK(set.contains(5));
+        BOOST_CHECK(not set.contains(4));
+    }
+
+    BOOST_AUTO_TEST_CASE(negative_values_are_found)
+    {
+        burst::compressed_k_ary_search_set<int> set({-100, -3, 0, 7, -1, 42, -42}, 4);
+
+        for (auto x: {-100, -3, 0, 7, -1, 42, -42})
+        {
+            BOOST_CHECK(set.contains(x));
+        }
+        for (auto x: {-101, -2, 1, 8, 41, 43, std::numeric_limits<int>::min()})
+        {
+            BOOST_CHECK(not set.contains(x));
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(compresses_dense_values_to_bytes)
+    {
+        std::vector<std::uint64_t> numbers(10000);
+        std::iota(numbers.begin(), numbers.end(), 1000000);
+
+        burst::compressed_k_ary_search_set<std::uint64_t>
+            set(burst::container::unique_ordered_tag, numbers.begin(), numbers.end(), 9);
+
+        BOOST_CHECK_LT(set.memory_usage(), numbers.size() * sizeof(std::uint64_t) / 2);
+        for (auto x: numbers)
+        {
+            BOOST_CHECK(set.contains(x));
+        }
+        BOOST_CHECK(not set.contains(999999));
+        BOOST_CHECK(not set.contains(1010000));
+    }
+
+    BOOST_AUTO_TEST_CASE(values_spanning_the_whole_type_range_are_found)
+    {
+        const auto min = std::numeric_limits<std::int64_t>::min();
+        const auto max = std::numeric_limits<std::int64_t>::max();
+        auto numbers = burst::make_vector<std::int64_t>({min, min + 1, -65536, -1, 0, 255, 256, 65536, 1ll << 40, max - 1, max});
+
+        burst::compressed_k_ary_search_set<std::int64_t> set(numbers.begin(), numbers.end(), 3);
+
+        for (auto x: numbers)
+        {
+            BOOST_CHECK(set.contains(x));
+        }
+        for (auto x: {min + 2, std::int64_t{-2}, std::int64_t{1}, std::int64_t{257}, max - 2})
+        {
+            BOOST_CHECK(not set.contains(x));
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(narrow_integers_are_supported)
+    {
+        std::vector<std::int8_t> numbers{-128, -1, 0, 1, 127};
+
+        burst::compressed_k_ary_search_set<std::int8_t> set(numbers.begin(), numbers.end(), 2);
+
+        for (auto x = -128; x <= 127; ++x)
+        {
+            const auto value = static_cast<std::int8_t>(x);
+            BOOST_CHECK_EQUAL(set.contains(value), std::count(numbers.begin(), numbers.end(), value) == 1);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(agrees_with_k_ary_search_set_for_all_arities)
+    {
+        std::vector<std::int32_t> numbers;
+        for (std::int32_t i = 0; i < 1000; ++i)
+        {
+            numbers.push_back(i * i * (i % 2 == 0 ? 1 : -1));
+        }
+
+        for (std::size_t arity = 2; arity < 40; ++arity)
+        {
+            burst::k_ary_search_set<std::int32_t> expected(numbers.begin(), numbers.end(), arity);
+            burst::compressed_k_ary_search_set<std::int32_t> set(expected);
+
+            BOOST_CHECK_EQUAL(set.size(), expected.size());
+            BOOST_CHECK_EQUAL(set.arity(), arity);
+            for (std::int32_t x = -1000; x < 1000; ++x)
+            {
+                BOOST_CHECK_EQUAL(set.contains(x * 997), expected.find(x * 997) != expected.end());
+            }
+            for (auto x: numbers)
+            {
+                BOOST_CHECK(set.contains(x));
+            }
+        }
+    }
+BOOST_AUTO_TEST_SUITE_END()
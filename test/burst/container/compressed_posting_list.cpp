@@ -0,0 +1,161 @@
+#include <burst/container/compressed_posting_list.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+#include <burst/range/intersect.hpp>
+#include <burst/range/make_range_vector.hpp>
+#include <burst/range/semiintersect.hpp>
+#include <burst/range/skip_to_lower_bound.hpp>
+#include <burst/range/unite.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+    //!     Упорядоченный набор, в котором встречаются и повторы, и очень большие скачки.
+    std::vector<std::int64_t> generate_postings (std::size_t size, std::mt19937_64 & engine)
+    {
+        std::uniform_int_distribution<std::int64_t> gap(0, 20);
+        std::bernoulli_distribution jump(0.01);
+
+        std::vector<std::int64_t> values(size);
+        auto value = std::numeric_limits<std::int64_t>::min() / 2;
+        for (auto & v: values)
+        {
+            value += jump(engine) ? std::numeric_limits<std::int64_t>::max() / 1024 : gap(engine);
+            v = value;
+        }
+
+        return values;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(compressed_posting_list)
+    BOOST_AUTO_TEST_CASE(compressed_posting_list_initialized_with_default_constructor_is_empty)
+    {
+        burst::compressed_posting_list<int> list;
+        BOOST_CHECK(list.empty());
+        BOOST_CHECK_EQUAL(list.size(), 0);
+        BOOST_CHECK(list.begin() == list.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(holds_ordered_elements_of_initial_range_with_duplicates)
+    {
+        burst::compressed_posting_list<int> list({5, -3, 5, 1, 3, -3, 0});
+
+        const auto expected = {-3, -3, 0, 1, 3, 5, 5};
+        BOOST_CHECK_EQUAL(list.size(), expected.size());
+        BOOST_CHECK_EQUAL_COLLECTIONS(list.begin(), list.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(restores_elements_of_every_block_exactly)
+    {
+        std::mt19937_64 engine(2017);
+        const auto values = generate_postings(1000, engine);
+
+        burst::compressed_posting_list<std::int64_t> list(burst::container::unique_ordered_tag, values.begin(), values.end());
+
+        BOOST_CHECK_EQUAL(list.size(), values.size());
+        BOOST_CHECK_EQUAL_COLLECTIONS(list.begin(), list.end(), values.begin(), values.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(extreme_values_are_stored_exactly)
+    {
+        const auto min = std::numeric_limits<std::int32_t>::min();
+        const auto max = std::numeric_limits<std::int32_t>::max();
+        burst::compressed_posting_list<std::int32_t> list({max, min, 0, min, max});
+
+        const auto expected = {min, min, 0, max, max};
+        BOOST_CHECK_EQUAL_COLLECTIONS(list.begin(), list.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(dense_list_takes_less_memory_than_plain_array)
+    {
+        std::vector<std::uint64_t> values(10000);
+        std::iota(values.begin(), values.end(), std::uint64_t{1} << 40);
+
+        burst::compressed_posting_list<std::uint64_t> list(values.begin(), values.end());
+
+        BOOST_CHECK_LT(list.memory_usage() * 8, values.size() * sizeof(std::uint64_t));
+    }
+
+    BOOST_AUTO_TEST_CASE(skip_to_lower_bound_stops_at_the_same_element_as_on_plain_array)
+    {
+        std::mt19937_64 engine(2017);
+        const auto values = generate_postings(2000, engine);
+        burst::compressed_posting_list<std::int64_t> list(burst::container::unique_ordered_tag, values.begin(), values.end());
+
+        std::uniform_int_distribution<std::size_t> position(0, values.size() - 1);
+        for (auto attempt = 0; attempt < 500; ++attempt)
+        {
+            const auto start = position(engine);
+            const auto goal = values[position(engine)] + (attempt % 3) - 1;
+
+            auto compressed = boost::make_iterator_range(list);
+            compressed.advance_begin(static_cast<std::ptrdiff_t>(start));
+            auto plain = boost::make_iterator_range(values);
+            plain.advance_begin(static_cast<std::ptrdiff_t>(start));
+
+            using burst::skip_to_lower_bound;
+            skip_to_lower_bound(compressed, goal);
+            skip_to_lower_bound(plain, goal);
+
+            BOOST_CHECK_EQUAL_COLLECTIONS(compressed.begin(), compressed.end(), plain.begin(), plain.end());
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(ranges_of_compressed_lists_are_intersected_and_united_as_plain_ones)
+    {
+        std::mt19937_64 engine(2017);
+        std::uniform_int_distribution<int> value(0, 5000);
+
+        std::vector<std::vector<int>> values(3);
+        std::vector<burst::compressed_posting_list<int>> lists;
+        for (auto & v: values)
+        {
+            v.resize(1500);
+            std::generate(v.begin(), v.end(), [&] {return value(engine);});
+            std::sort(v.begin(), v.end());
+            lists.emplace_back(v.begin(), v.end());
+        }
+
+        auto plain = burst::make_range_vector(values[0], values[1], values[2]);
+        auto compressed = burst::make_range_vector(lists[0], lists[1], lists[2]);
+
+        const auto plain_intersection = burst::intersect(plain);
+        const auto compressed_intersection = burst::intersect(compressed);
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            compressed_intersection.begin(), compressed_intersection.end(),
+            plain_intersection.begin(), plain_intersection.end()
+        );
+
+        plain = burst::make_range_vector(values[0], values[1], values[2]);
+        compressed = burst::make_range_vector(lists[0], lists[1], lists[2]);
+
+        const auto plain_semiintersection = burst::semiintersect(plain, 2);
+        const auto compressed_semiintersection = burst::semiintersect(compressed, 2);
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            compressed_semiintersection.begin(), compressed_semiintersection.end(),
+            plain_semiintersection.begin(), plain_semiintersection.end()
+        );
+
+        plain = burst::make_range_vector(values[0], values[1], values[2]);
+        compressed = burst::make_range_vector(lists[0], lists[1], lists[2]);
+
+        const auto plain_union = burst::unite(plain);
+        const auto compressed_union = burst::unite(compressed);
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            compressed_union.begin(), compressed_union.end(),
+            plain_union.begin(), plain_union.end()
+        );
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -4,7 +4,9 @@
 #include <boost/test/unit_test.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
 #include <numeric>
 #include <vector>
 
@@ -149,6 +151,191 @@ BOOST_AUTO_TEST_SUITE(k_ary_search)
         BOOST_CHECK(set.find(8) == set.end());
     }
 
+    BOOST_AUTO_TEST_CASE(copy_ordered_writes_elements_in_ascending_order)
+    {
+        for (std::size_t arity = 2; arity < 7; ++arity)
+        {
+            for (int size = 0; size < 100; ++size)
+            {
+                std::vector<int> numbers(static_cast<std::size_t>(size));
+                std::iota(numbers.begin(), numbers.end(), 0);
+
+                burst::k_ary_search_set<int> set(numbers.begin(), numbers.end(), arity);
+
+                std::vector<int> ordered;
+                set.copy_ordered(std::back_inserter(ordered));
+
+                BOOST_CHECK(ordered == numbers);
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(copy_ordered_respects_custom_order)
+    {
+        burst::k_ary_search_set<int, std::greater<>> set({3, 4, 6, 1, 7, 8, 2}, 3);
+
+        std::vector<int> ordered;
+        set.copy_ordered(std::back_inserter(ordered));
+
+        auto expected = {8, 7, 6, 4, 3, 2, 1};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            ordered.begin(), ordered.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_construction_results_the_same_layout_as_sequential_one)
+    {
+        for (std::size_t arity = 2; arity < 6; ++arity)
+        {
+            for (auto size: {0, 1, 7, 100, 1000, 5000})
+            {
+                std::vector<int> numbers(static_cast<std::size_t>(size));
+                std::iota(numbers.begin(), numbers.end(), 0);
+
+                burst::k_ary_search_set<int> sequential
+                    (burst::container::unique_ordered_tag, numbers.begin(), numbers.end(), arity);
+                for (auto thread_count: {2u, 3u, 8u})
+                {
+                    burst::k_ary_search_set<int> parallel
+                    (
+                        burst::par(thread_count),
+                        burst::container::unique_ordered_tag,
+                        numbers.begin(), numbers.end(),
+                        arity
+                    );
+
+                    BOOST_CHECK_EQUAL_COLLECTIONS
+                    (
+                        parallel.begin(), parallel.end(),
+                        sequential.begin(), sequential.end()
+                    );
+                }
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_construction_from_unordered_range_sorts_it_first)
+    {
+        auto numbers = burst::make_vector({3, 4, 6, 1, 7, 8, 2, 6, 3});
+
+        burst::k_ary_search_set<int> set(burst::par(4), numbers.begin(), numbers.end(), 3);
+
+        BOOST_CHECK_EQUAL(set.size(), 7);
+        for (auto x: {1, 2, 3, 4, 6, 7, 8})
+        {
+            BOOST_CHECK_EQUAL(*set.find(x), x);
+        }
+        BOOST_CHECK(set.find(5) == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(unordered_integers_with_duplicates_and_negatives_are_sorted_and_deduplicated)
+    {
+        auto numbers = burst::make_vector({5, -3, 100, 0, -3, 7, -100500, 5, 42, 0});
+
+        burst::k_ary_search_set<int> set(numbers.begin(), numbers.end(), 3);
+        burst::k_ary_search_set<int> expected
+            (burst::container::unique_ordered_tag, {-100500, -3, 0, 5, 7, 42, 100}, 3);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            set.begin(), set.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(unordered_small_unsigned_integers_are_sorted_and_deduplicated)
+    {
+        std::vector<std::uint8_t> numbers{200, 3, 255, 0, 3, 17, 200};
+
+        burst::k_ary_search_set<std::uint8_t> set(numbers.begin(), numbers.end(), 2);
+
+        std::vector<std::uint8_t> ordered;
+        set.copy_ordered(std::back_inserter(ordered));
+
+        std::vector<std::uint8_t> expected{0, 3, 17, 200, 255};
+        BOOST_CHECK(ordered == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(unordered_integers_with_custom_order_are_sorted_with_that_order)
+    {
+        std::vector<std::int64_t> numbers{5, -3, 100, 0, -3, 7};
+
+        burst::k_ary_search_set<std::int64_t, std::greater<>> set(numbers.begin(), numbers.end(), 3);
+
+        std::vector<std::int64_t> ordered;
+        set.copy_ordered(std::back_inserter(ordered));
+
+        std::vector<std::int64_t> expected{100, 7, 5, 0, -3};
+        BOOST_CHECK(ordered == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(contains_sorted_writes_found_probes_in_order)
+    {
+        burst::k_ary_search_set<int> set({3, 4, 6, 1, 7, 8, 2}, 3);
+        auto probes = {0, 1, 2, 5, 6, 6, 8, 9};
+
+        std::vector<int> found;
+        set.contains_sorted(probes.begin(), probes.end(), std::back_inserter(found));
+
+        auto expected = {1, 2, 6, 6, 8};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            found.begin(), found.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(contains_sorted_on_empty_set_finds_nothing)
+    {
+        burst::k_ary_search_set<int> set;
+        auto probes = {1, 2, 3};
+
+        std::vector<int> found;
+        set.contains_sorted(probes.begin(), probes.end(), std::back_inserter(found));
+
+        BOOST_CHECK(found.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(contains_sorted_agrees_with_find_for_all_arities)
+    {
+        std::vector<int> numbers(500);
+        std::generate(numbers.begin(), numbers.end(), [n = 0] () mutable { return n += 3; });
+
+        std::vector<int> probes(1700);
+        std::iota(probes.begin(), probes.end(), -100);
+
+        for (std::size_t arity = 2; arity < 20; ++arity)
+        {
+            burst::k_ary_search_set<int> set(numbers.begin(), numbers.end(), arity);
+
+            std::vector<int> found;
+            set.contains_sorted(probes.begin(), probes.end(), std::back_inserter(found));
+
+            std::vector<int> expected;
+            std::copy_if(probes.begin(), probes.end(), std::back_inserter(expected),
+                [& set] (auto x) { return set.find(x) != set.end(); });
+            BOOST_CHECK(found == expected);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(contains_sorted_respects_custom_order)
+    {
+        burst::k_ary_search_set<int, std::greater<>> set({3, 4, 6, 1, 7, 8, 2}, 2);
+        auto probes = {9, 8, 5, 4, 3, 0};
+
+        std::vector<int> found;
+        set.contains_sorted(probes.begin(), probes.end(), std::back_inserter(found));
+
+        auto expected = {8, 4, 3};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            found.begin(), found.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
     BOOST_AUTO_TEST_CASE(mutable_find_method_exists)
     {
         burst::k_ary_search_set<int> set;
@@ -0,0 +1,167 @@
+#include <burst/container/k_ary_search_set.hpp>
+#include <burst/container/k_ary_search_set_view.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Образ копируется в буфер из 64-битных слов, чтобы элементы были выровнены.
+    template <typename Value, typename Compare>
+    std::vector<std::uint64_t> make_image (const burst::k_ary_search_set<Value, Compare> & set)
+    {
+        std::ostringstream stream;
+        burst::write_k_ary_search_set(stream, set);
+        const auto bytes = stream.str();
+
+        std::vector<std::uint64_t> image((bytes.size() + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+        std::memcpy(image.data(), bytes.data(), bytes.size());
+        return image;
+    }
+
+    std::size_t byte_size (const std::vector<std::uint64_t> & image)
+    {
+        return image.size() * sizeof(std::uint64_t);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(k_ary_search_set_view)
+    BOOST_AUTO_TEST_CASE(view_has_the_same_layout_as_the_set_it_was_written_from)
+    {
+        std::vector<std::int64_t> numbers(1000);
+        std::iota(numbers.begin(), numbers.end(), -500);
+        burst::k_ary_search_set<std::int64_t> set(numbers.begin(), numbers.end(), 5);
+
+        const auto image = make_image(set);
+        burst::k_ary_search_set_view<std::int64_t> view(image.data(), byte_size(image));
+
+        BOOST_CHECK_EQUAL(view.size(), set.size());
+        BOOST_CHECK_EQUAL(view.arity(), set.arity());
+        BOOST_CHECK_EQUAL_COLLECTIONS(view.begin(), view.end(), set.begin(), set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(view_finds_every_element_of_the_set)
+    {
+        std::vector<std::int64_t> numbers(300);
+        std::iota(numbers.begin(), numbers.end(), 0);
+        burst::k_ary_search_set<std::int64_t, std::greater<>>
+            set(numbers.begin(), numbers.end(), 4, std::greater<>{});
+
+        const auto image = make_image(set);
+        burst::k_ary_search_set_view<std::int64_t, std::greater<>> view(image.data(), byte_size(image));
+
+        for (auto number: numbers)
+        {
+            BOOST_CHECK_EQUAL(*view.find(number), number);
+        }
+        BOOST_CHECK(view.find(-1) == view.end());
+        BOOST_CHECK(view.find(300) == view.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(view_of_empty_set_is_empty)
+    {
+        const auto image = make_image(burst::k_ary_search_set<int>{});
+        burst::k_ary_search_set_view<int> view(image.data(), byte_size(image));
+
+        BOOST_CHECK(view.empty());
+        BOOST_CHECK(view.find(1) == view.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(view_of_image_with_wrong_signature_cannot_be_created)
+    {
+        auto image = make_image(burst::k_ary_search_set<int>{1, 2, 3});
+        reinterpret_cast<char *>(image.data())[0] = 'X';
+
+        BOOST_CHECK_THROW
+        (
+            burst::k_ary_search_set_view<int>(image.data(), byte_size(image)),
+            std::invalid_argument
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(view_of_image_with_different_value_type_cannot_be_created)
+    {
+        const auto image = make_image(burst::k_ary_search_set<std::int32_t>{1, 2, 3});
+
+        BOOST_CHECK_THROW
+        (
+            burst::k_ary_search_set_view<std::int64_t>(image.data(), byte_size(image)),
+            std::invalid_argument
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(view_of_image_with_arity_less_than_two_cannot_be_created)
+    {
+        auto image = make_image(burst::k_ary_search_set<std::int64_t>{1, 2, 3});
+        const auto arity_offset = offsetof(burst::detail::k_ary_search_set_image_header, arity);
+
+        const std::uint64_t arities[] = {0, 1};
+        for (const auto arity: arities)
+        {
+            std::memcpy(reinterpret_cast<char *>(image.data()) + arity_offset, &arity, sizeof(arity));
+
+            BOOST_CHECK_THROW
+            (
+                burst::k_ary_search_set_view<std::int64_t>(image.data(), byte_size(image)),
+                std::invalid_argument
+            );
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(view_of_image_with_overflowing_arity_cannot_be_created)
+    {
+        auto image = make_image(burst::k_ary_search_set<std::int64_t>{1, 2, 3});
+        const auto arity_offset = offsetof(burst::detail::k_ary_search_set_image_header, arity);
+
+        const std::uint64_t arities[] =
+            {(std::uint64_t{1} << 63) + 1, std::uint64_t{1} << 32, std::numeric_limits<std::uint64_t>::max()};
+        for (const auto arity: arities)
+        {
+            std::memcpy(reinterpret_cast<char *>(image.data()) + arity_offset, &arity, sizeof(arity));
+
+            BOOST_CHECK_THROW
+            (
+                burst::k_ary_search_set_view<std::int64_t>(image.data(), byte_size(image)),
+                std::invalid_argument
+            );
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(view_of_set_with_arity_greater_than_its_size_can_be_created)
+    {
+        const auto set = burst::k_ary_search_set<std::int64_t>({1, 2, 3}, 1000);
+        const auto image = make_image(set);
+
+        const auto view = burst::k_ary_search_set_view<std::int64_t>(image.data(), byte_size(image));
+
+        BOOST_CHECK_EQUAL(view.arity(), 1000u);
+        BOOST_CHECK(view.find(2) != view.end());
+        BOOST_CHECK(view.find(4) == view.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(view_of_truncated_image_cannot_be_created)
+    {
+        const auto image = make_image(burst::k_ary_search_set<std::int64_t>{1, 2, 3});
+
+        BOOST_CHECK_THROW
+        (
+            burst::k_ary_search_set_view<std::int64_t>(image.data(), byte_size(image) - 1),
+            std::invalid_argument
+        );
+        BOOST_CHECK_THROW
+        (
+            burst::k_ary_search_set_view<std::int64_t>(image.data(), 10),
+            std::invalid_argument
+        );
+    }
+BOOST_AUTO_TEST_SUITE_END()
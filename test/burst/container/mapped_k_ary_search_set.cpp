@@ -0,0 +1,100 @@
+#include <burst/container/k_ary_search_set.hpp>
+#include <burst/container/k_ary_search_set_view.hpp>
+#include <burst/container/mapped_k_ary_search_set.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    struct temporary_file
+    {
+        temporary_file ():
+            path("/tmp/burst_mapped_k_ary_search_set_XXXXXX")
+        {
+            const auto descriptor = ::mkstemp(&path[0]);
+            BOOST_REQUIRE(descriptor != -1);
+            ::close(descriptor);
+        }
+
+        ~temporary_file ()
+        {
+            std::remove(path.c_str());
+        }
+
+        std::string path;
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(mapped_k_ary_search_set)
+    BOOST_AUTO_TEST_CASE(mapped_set_finds_every_element_of_written_set)
+    {
+        std::vector<std::uint32_t> numbers(5000);
+        std::iota(numbers.begin(), numbers.end(), 100u);
+        burst::k_ary_search_set<std::uint32_t> set(numbers.begin(), numbers.end(), 17);
+
+        temporary_file file;
+        {
+            std::ofstream stream(file.path, std::ios::binary);
+            burst::write_k_ary_search_set(stream, set);
+        }
+
+        burst::mapped_k_ary_search_set<std::uint32_t> mapped(file.path);
+
+        BOOST_CHECK_EQUAL(mapped.size(), set.size());
+        BOOST_CHECK_EQUAL_COLLECTIONS(mapped.begin(), mapped.end(), set.begin(), set.end());
+        for (auto number: numbers)
+        {
+            BOOST_CHECK_EQUAL(*mapped.find(number), number);
+        }
+        BOOST_CHECK(mapped.find(99) == mapped.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(mapped_set_can_be_moved)
+    {
+        temporary_file file;
+        {
+            std::ofstream stream(file.path, std::ios::binary);
+            burst::write_k_ary_search_set(stream, burst::k_ary_search_set<int>{1, 2, 3});
+        }
+
+        burst::mapped_k_ary_search_set<int> mapped(file.path);
+        auto moved = std::move(mapped);
+
+        BOOST_CHECK(mapped.empty());
+        BOOST_CHECK_EQUAL(moved.size(), 3);
+        BOOST_CHECK_EQUAL(*moved.find(2), 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(mapping_absent_file_throws_system_error)
+    {
+        BOOST_CHECK_THROW
+        (
+            burst::mapped_k_ary_search_set<int>("/nonexistent/burst/k_ary_search_set"),
+            std::system_error
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(mapping_empty_file_throws_invalid_argument)
+    {
+        temporary_file file;
+
+        BOOST_CHECK_THROW
+        (
+            burst::mapped_k_ary_search_set<int>(file.path),
+            std::invalid_argument
+        );
+    }
+BOOST_AUTO_TEST_SUITE_END()
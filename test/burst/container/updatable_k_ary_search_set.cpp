@@ -0,0 +1,144 @@
+#include <burst/container/make_vector.hpp>
+#include <burst/container/updatable_k_ary_search_set.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+#include <numeric>
+#include <set>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(updatable_k_ary_search_set)
+    BOOST_AUTO_TEST_CASE(updatable_k_ary_search_set_initialized_with_default_constructor_is_empty)
+    {
+        burst::updatable_k_ary_search_set<int> set;
+        BOOST_CHECK(set.empty());
+        BOOST_CHECK_EQUAL(set.size(), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(contains_elements_of_initial_range)
+    {
+        auto numbers = burst::make_vector({3, 4, 6, 1, 7, 8, 2});
+
+        burst::updatable_k_ary_search_set<int> set(numbers.begin(), numbers.end(), 3);
+
+        BOOST_CHECK(set.contains(6));
+        BOOST_CHECK(not set.contains(5));
+        BOOST_CHECK_EQUAL(set.size(), numbers.size());
+    }
+
+    BOOST_AUTO_TEST_CASE(inserted_element_is_found_before_rebuild)
+    {
+        burst::updatable_k_ary_search_set<int> set({1, 3, 5}, 3, 10);
+
+        BOOST_CHECK(set.insert(4));
+
+        BOOST_CHECK(set.contains(4));
+        BOOST_CHECK_EQUAL(set.size(), 4);
+        BOOST_CHECK_EQUAL(set.pending(), 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(inserting_existing_element_does_nothing)
+    {
+        burst::updatable_k_ary_search_set<int> set({1, 3, 5}, 3, 10);
+
+        BOOST_CHECK(not set.insert(3));
+        BOOST_CHECK(set.insert(4));
+        BOOST_CHECK(not set.insert(4));
+
+        BOOST_CHECK_EQUAL(set.size(), 4);
+    }
+
+    BOOST_AUTO_TEST_CASE(erased_element_is_not_found_before_rebuild)
+    {
+        burst::updatable_k_ary_search_set<int> set({1, 3, 5}, 3, 10);
+
+        BOOST_CHECK_EQUAL(set.erase(3), 1);
+
+        BOOST_CHECK(not set.contains(3));
+        BOOST_CHECK_EQUAL(set.size(), 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(erasing_absent_element_returns_zero)
+    {
+        burst::updatable_k_ary_search_set<int> set({1, 3, 5}, 3, 10);
+
+        BOOST_CHECK_EQUAL(set.erase(4), 0);
+        BOOST_CHECK_EQUAL(set.erase(3), 1);
+        BOOST_CHECK_EQUAL(set.erase(3), 0);
+        BOOST_CHECK_EQUAL(set.size(), 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(element_erased_and_inserted_again_is_found)
+    {
+        burst::updatable_k_ary_search_set<int> set({1, 3, 5}, 3, 10);
+
+        set.erase(3);
+        BOOST_CHECK(set.insert(3));
+
+        BOOST_CHECK(set.contains(3));
+        BOOST_CHECK_EQUAL(set.pending(), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(rebuild_applies_pending_changes)
+    {
+        burst::updatable_k_ary_search_set<int> set({1, 3, 5, 7}, 3, 10);
+        set.insert(4);
+        set.insert(0);
+        set.erase(5);
+
+        set.rebuild();
+
+        BOOST_CHECK_EQUAL(set.pending(), 0);
+        BOOST_CHECK_EQUAL(set.size(), 5);
+        for (auto x: {0, 1, 3, 4, 7})
+        {
+            BOOST_CHECK(set.contains(x));
+        }
+        BOOST_CHECK(not set.contains(5));
+    }
+
+    BOOST_AUTO_TEST_CASE(set_is_rebuilt_automatically_when_too_many_changes_are_pending)
+    {
+        burst::updatable_k_ary_search_set<int> set({10, 20, 30}, 3, 2);
+
+        set.insert(1);
+        set.insert(2);
+        BOOST_CHECK_EQUAL(set.pending(), 2);
+
+        set.erase(20);
+        BOOST_CHECK_EQUAL(set.pending(), 0);
+        BOOST_CHECK_EQUAL(set.size(), 4);
+        BOOST_CHECK(set.contains(1));
+        BOOST_CHECK(not set.contains(20));
+    }
+
+    BOOST_AUTO_TEST_CASE(behaves_like_std_set_under_mixed_updates)
+    {
+        std::vector<int> initial(100);
+        std::iota(initial.begin(), initial.end(), 0);
+
+        burst::updatable_k_ary_search_set<int, std::greater<>>
+            set(initial.begin(), initial.end(), 4, 7, std::greater<>{});
+        std::set<int, std::greater<>> expected(initial.begin(), initial.end());
+
+        for (int i = 0; i < 300; ++i)
+        {
+            const auto value = (i * 37) % 150;
+            if (i % 3 == 0)
+            {
+                BOOST_CHECK_EQUAL(set.erase(value), expected.erase(value));
+            }
+            else
+            {
+                BOOST_CHECK_EQUAL(set.insert(value), expected.insert(value).second);
+            }
+            BOOST_CHECK_EQUAL(set.size(), expected.size());
+        }
+
+        for (int value = -10; value < 160; ++value)
+        {
+            BOOST_CHECK_EQUAL(set.contains(value), expected.count(value) == 1);
+        }
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,30 @@
+#include <burst/integer/countr_zero.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+
+BOOST_AUTO_TEST_SUITE(countr_zero)
+    BOOST_AUTO_TEST_CASE(countr_zero_of_zero_is_number_of_digits)
+    {
+        BOOST_CHECK_EQUAL(burst::countr_zero(std::uint64_t{0}), 64);
+        BOOST_CHECK_EQUAL(burst::countr_zero(std::uint16_t{0}), 16);
+    }
+
+    BOOST_AUTO_TEST_CASE(countr_zero_of_odd_number_is_zero)
+    {
+        BOOST_CHECK_EQUAL(burst::countr_zero(7u), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(countr_zero_is_position_of_lowest_set_bit)
+    {
+        BOOST_CHECK_EQUAL(burst::countr_zero(0b101000u), 3);
+        BOOST_CHECK_EQUAL(burst::countr_zero(std::uint64_t{1} << 63), 63);
+    }
+
+    BOOST_AUTO_TEST_CASE(countr_zero_is_a_constexpr_function)
+    {
+        constexpr auto x = burst::countr_zero(0x100ul);
+        BOOST_CHECK_EQUAL(x, 8);
+    }
+BOOST_AUTO_TEST_SUITE_END()
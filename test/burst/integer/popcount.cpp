@@ -0,0 +1,30 @@
+#include <burst/integer/popcount.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <limits>
+
+BOOST_AUTO_TEST_SUITE(popcount)
+    BOOST_AUTO_TEST_CASE(popcount_of_zero_is_zero)
+    {
+        BOOST_CHECK_EQUAL(burst::popcount(0u), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(popcount_counts_set_bits)
+    {
+        BOOST_CHECK_EQUAL(burst::popcount(0b1011010u), 4);
+    }
+
+    BOOST_AUTO_TEST_CASE(popcount_of_maximal_value_is_number_of_digits)
+    {
+        BOOST_CHECK_EQUAL(burst::popcount(std::numeric_limits<std::uint64_t>::max()), 64);
+        BOOST_CHECK_EQUAL(burst::popcount(std::numeric_limits<std::uint8_t>::max()), 8);
+    }
+
+    BOOST_AUTO_TEST_CASE(popcount_is_a_constexpr_function)
+    {
+        constexpr auto x = burst::popcount(0xf0f0ul);
+        BOOST_CHECK_EQUAL(x, 8);
+    }
+BOOST_AUTO_TEST_SUITE_END()
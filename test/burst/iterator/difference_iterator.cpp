@@ -61,4 +61,30 @@ BOOST_AUTO_TEST_SUITE(difference_iterator)
             std::begin(expected_collection), std::end(expected_collection)
         );
     }
+
+    BOOST_AUTO_TEST_CASE(chunked_difference_iterator_end_is_created_using_special_tag)
+    {
+        const auto minuend = burst::make_forward_list({1, 2, 3, 4, 5});
+        const auto subtrahend = burst::make_forward_list({3});
+
+        const auto difference_begin =
+            burst::make_difference_iterator(burst::iterator::chunked_difference, minuend, subtrahend);
+        const auto difference_end =
+            burst::make_difference_iterator(burst::iterator::end_tag, difference_begin);
+
+        BOOST_REQUIRE_EQUAL(std::distance(difference_begin, difference_end), 2);
+
+        const auto first_chunk = {1, 2};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference_begin->begin(), difference_begin->end(),
+            std::begin(first_chunk), std::end(first_chunk)
+        );
+        const auto second_chunk = {4, 5};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::next(difference_begin)->begin(), std::next(difference_begin)->end(),
+            std::begin(second_chunk), std::end(second_chunk)
+        );
+    }
 BOOST_AUTO_TEST_SUITE_END()
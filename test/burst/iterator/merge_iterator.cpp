@@ -23,4 +23,23 @@ BOOST_AUTO_TEST_SUITE(merge_iterator)
             std::begin(expected_collection), std::end(expected_collection)
         );
     }
+
+    BOOST_AUTO_TEST_CASE(loser_tree_merge_iterator_end_is_created_using_special_tag)
+    {
+        auto  first = {500, 100};
+        auto second = {600, 200};
+        auto  third = {300};
+        auto ranges = burst::make_range_vector(first, second, third);
+
+        auto merged_begin =
+            burst::make_merge_iterator(burst::iterator::loser_tree_merge, ranges, std::greater<>{});
+        auto merged_end = burst::make_merge_iterator(burst::iterator::end_tag, merged_begin);
+
+        auto expected_collection = {600, 500, 300, 200, 100};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            merged_begin, merged_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
 BOOST_AUTO_TEST_SUITE_END()
@@ -6,9 +6,12 @@
 #include <boost/range/algorithm/for_each.hpp>
 #include <boost/range/algorithm/set_algorithm.hpp>
 #include <boost/range/iterator_range.hpp>
+#include <boost/range/size.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <cstddef>
 #include <functional>
+#include <iterator>
 #include <vector>
 
 BOOST_AUTO_TEST_SUITE(difference)
@@ -140,4 +143,97 @@ BOOST_AUTO_TEST_SUITE(difference)
             expected.begin(), expected.end()
         );
     }
+
+    BOOST_AUTO_TEST_CASE(chunked_difference_consists_of_largest_contiguous_parts_of_minuend)
+    {
+        const auto    minuend = burst::make_vector({1, 2, 3, 4, 5, 6, 7, 8, 9});
+        const auto subtrahend = burst::make_vector({0,       4,          8   });
+        //                                          ^  ^  ^     ^  ^  ^     ^
+
+        const auto difference = burst::difference(burst::iterator::chunked_difference, minuend, subtrahend);
+
+        const auto expected = std::vector<std::size_t>{3, 3, 1};
+        std::vector<std::size_t> chunk_sizes;
+        boost::for_each(difference,
+            [& chunk_sizes] (const auto & chunk)
+            {
+                chunk_sizes.push_back(boost::size(chunk));
+            });
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            chunk_sizes.begin(), chunk_sizes.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(chunk_is_not_broken_by_subtrahend_elements_absent_from_minuend)
+    {
+        const auto    minuend = burst::make_vector({1, 2,       5, 6,       9, 10    });
+        const auto subtrahend = burst::make_vector({      3, 4,       7, 8, 9,     11});
+        //                                          ^  ^        ^  ^           ^
+
+        const auto difference = burst::difference(burst::iterator::chunked_difference, minuend, subtrahend);
+
+        const auto expected = std::vector<std::size_t>{4, 1};
+        std::vector<std::size_t> chunk_sizes;
+        boost::for_each(difference,
+            [& chunk_sizes] (const auto & chunk)
+            {
+                chunk_sizes.push_back(boost::size(chunk));
+            });
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            chunk_sizes.begin(), chunk_sizes.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(subtrahend_falling_into_a_gap_of_forward_minuend_leaves_one_chunk)
+    {
+        const auto    minuend = burst::make_list({1, 2,    5, 6});
+        const auto subtrahend = burst::make_list({      3      });
+
+        const auto difference = burst::difference(burst::iterator::chunked_difference, minuend, subtrahend);
+
+        BOOST_REQUIRE_EQUAL(std::distance(difference.begin(), difference.end()), 1);
+        const auto expected = {1, 2, 5, 6};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference.front().begin(), difference.front().end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(chunked_difference_yields_the_same_elements_as_elementwise_one)
+    {
+        const auto    minuend = burst::make_list({1, 1, 1, 2,    4, 4,    6    });
+        const auto subtrahend = burst::make_list({   1,    2, 3, 4, 4, 5,    7});
+
+        std::vector<int> chunked;
+        boost::for_each
+        (
+            burst::difference(burst::iterator::chunked_difference, minuend, subtrahend, std::less<>{}),
+            [& chunked] (const auto & chunk)
+            {
+                chunked.insert(chunked.end(), chunk.begin(), chunk.end());
+            }
+        );
+
+        const auto elementwise = burst::difference(minuend, subtrahend);
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            chunked.begin(), chunked.end(),
+            elementwise.begin(), elementwise.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(chunked_difference_with_empty_minuend_is_empty)
+    {
+        const auto minuend = std::vector<int>{};
+        const auto subtrahend = burst::make_vector({1, 2, 3});
+
+        const auto difference = burst::difference(burst::iterator::chunked_difference, minuend, subtrahend);
+
+        BOOST_CHECK(difference.empty());
+    }
 BOOST_AUTO_TEST_SUITE_END()
@@ -7,6 +7,8 @@
 #include <boost/range/iterator_range.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <string>
@@ -150,4 +152,130 @@ BOOST_AUTO_TEST_SUITE(intersect)
             std::begin(expected_collection), std::end(expected_collection)
         );
     }
+
+    BOOST_AUTO_TEST_CASE(intersecting_two_long_integer_ranges_results_their_common_elements)
+    {
+        std::vector<std::uint32_t> first;
+        std::vector<std::uint32_t> second;
+        for (std::uint32_t i = 0; i < 1000; ++i)
+        {
+            if (i % 3 == 0)
+            {
+                first.push_back(i);
+            }
+            if (i % 7 == 0)
+            {
+                second.push_back(i);
+            }
+        }
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto intersected_range = burst::intersect(ranges);
+
+        std::vector<std::uint32_t> expected_collection;
+        std::set_intersection(first.begin(), first.end(), second.begin(), second.end(),
+            std::back_inserter(expected_collection));
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(intersected_range), std::end(intersected_range),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(intersecting_two_disjoint_long_integer_ranges_results_empty_range)
+    {
+        const auto  first = burst::make_vector(boost::irange<std::uint64_t>(0, 64));
+        const auto second = burst::make_vector(boost::irange<std::uint64_t>(64, 128));
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto intersected_range = burst::intersect(ranges);
+
+        BOOST_CHECK(intersected_range.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(common_element_at_the_very_end_of_long_integer_ranges_is_found)
+    {
+        auto  first = burst::make_vector(boost::irange<std::int64_t>(0, 40));
+        auto second = burst::make_vector(boost::irange<std::int64_t>(100, 140));
+        first.push_back(1000);
+        second.push_back(1000);
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto intersected_range = burst::intersect(ranges);
+
+        auto expected_collection = {1000};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(intersected_range), std::end(intersected_range),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(repeating_elements_of_long_integer_ranges_do_not_produce_excess_matches)
+    {
+        std::vector<std::uint32_t>  first{1, 1, 1, 2, 2, 5, 5, 5, 5, 5, 7, 8, 9, 9, 9, 9, 9, 9, 10, 20};
+        std::vector<std::uint32_t> second{0, 1, 1, 3, 3, 3, 4, 5, 5, 9, 9, 9, 9, 9, 9, 9, 9, 20, 20};
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto intersected_range = burst::intersect(ranges);
+
+        std::vector<std::uint32_t> expected_collection;
+        std::set_intersection(first.begin(), first.end(), second.begin(), second.end(),
+            std::back_inserter(expected_collection));
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(intersected_range), std::end(intersected_range),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(prefetching_intersection_gives_the_same_result_as_plain_intersection)
+    {
+        std::vector<std::vector<std::uint32_t>> values(4);
+        for (std::uint32_t i = 0; i < 3000; ++i)
+        {
+            for (std::size_t k = 0; k < values.size(); ++k)
+            {
+                if (i % (k + 2) == 0)
+                {
+                    values[k].push_back(i);
+                }
+            }
+        }
+
+        std::vector<std::uint32_t> expected;
+        {
+            auto ranges = burst::make_range_vector(values[0], values[1], values[2], values[3]);
+            auto intersected_range = burst::intersect(ranges);
+            expected.assign(std::begin(intersected_range), std::end(intersected_range));
+        }
+
+        const std::size_t distances[] = {0, 3, 16, 100000};
+        for (auto distance: distances)
+        {
+            auto ranges = burst::make_range_vector(values[0], values[1], values[2], values[3]);
+            auto intersected_range = burst::intersect(burst::iterator::prefetch_t{distance}, ranges);
+            BOOST_CHECK_EQUAL_COLLECTIONS
+            (
+                std::begin(intersected_range), std::end(intersected_range),
+                std::begin(expected), std::end(expected)
+            );
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(prefetching_intersection_respects_custom_order)
+    {
+        auto  first = burst::make_list({10, 8, 6, 4, 2});
+        auto second = burst::make_list({9, 8, 4, 1});
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto intersected_range = burst::intersect(burst::iterator::prefetch_t{1}, ranges, std::greater<>{});
+
+        auto expected_collection = {8, 4};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(intersected_range), std::end(intersected_range),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
 BOOST_AUTO_TEST_SUITE_END()
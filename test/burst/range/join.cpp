@@ -1,5 +1,6 @@
 #include <burst/container/make_list.hpp>
 #include <burst/container/make_vector.hpp>
+#include <burst/iterator/join_policy.hpp>
 #include <burst/range/join.hpp>
 #include <burst/range/make_range_vector.hpp>
 
@@ -12,6 +13,8 @@
 #include <boost/range/rend.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <string>
 #include <vector>
@@ -241,4 +244,105 @@ BOOST_AUTO_TEST_SUITE(join)
 
         BOOST_CHECK(boost::algorithm::all_of(ranges, empty));
     }
+
+    BOOST_AUTO_TEST_CASE(indexed_join_of_empty_ranges_is_empty)
+    {
+        std::vector<int> first;
+        std::vector<int> second;
+        auto ranges = burst::make_range_vector(first, second);
+        auto empty = std::vector<boost::iterator_range<std::vector<int>::iterator>>{};
+
+        BOOST_CHECK(burst::join(burst::iterator::indexed_join, ranges).empty());
+        BOOST_CHECK(burst::join(burst::iterator::indexed_join, empty).empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(indexed_join_puts_ranges_one_after_another_skipping_empty_ones)
+    {
+        const auto empty = burst::make_vector<int>({});
+        const auto first = burst::make_vector({1, 2});
+        const auto second = burst::make_vector({3});
+        const auto third = burst::make_vector({4, 5, 6});
+        auto ranges = burst::make_range_vector(empty, first, empty, empty, second, third, empty);
+
+        auto joint_range = burst::join(burst::iterator::indexed_join, ranges);
+
+        auto expected_collection = {1, 2, 3, 4, 5, 6};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(joint_range), std::end(joint_range),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+        BOOST_CHECK_EQUAL(joint_range.size(), 6);
+    }
+
+    BOOST_AUTO_TEST_CASE(indexed_join_can_be_reversed)
+    {
+        std::string indexed("indexed");
+        std::string empty;
+        std::string join("join");
+        auto ranges = burst::make_range_vector(empty, indexed, empty, join, empty);
+
+        auto reversed_range = boost::adaptors::reverse(burst::join(burst::iterator::indexed_join, ranges));
+
+        std::string expected = indexed + join;
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(reversed_range), std::end(reversed_range),
+            boost::rbegin(expected), boost::rend(expected)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(indexed_join_jumps_to_any_element_in_both_directions)
+    {
+        std::vector<std::vector<int>> chunks;
+        std::vector<int> expected;
+        for (int chunk = 0; chunk < 50; ++chunk)
+        {
+            chunks.emplace_back();
+            for (int item = 0; item < chunk % 4; ++item)
+            {
+                chunks.back().push_back(static_cast<int>(expected.size()));
+                expected.push_back(static_cast<int>(expected.size()));
+            }
+        }
+
+        auto joint_range = burst::join(burst::iterator::indexed_join, chunks);
+        BOOST_REQUIRE_EQUAL(joint_range.size(), expected.size());
+
+        const auto size = static_cast<std::ptrdiff_t>(expected.size());
+        for (std::ptrdiff_t from = 0; from <= size; from += 7)
+        {
+            for (std::ptrdiff_t to = 0; to < size; to += 5)
+            {
+                auto position = joint_range.begin() + from;
+                position += to - from;
+                BOOST_CHECK_EQUAL(*position, to);
+                BOOST_CHECK_EQUAL(position - joint_range.begin(), to);
+                BOOST_CHECK_EQUAL(joint_range.end() - position, size - to);
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(indexed_join_of_sorted_chunks_supports_binary_search)
+    {
+        std::vector<std::vector<int>> chunks{{1, 3}, {}, {5}, {7, 9, 11}, {}, {13}};
+
+        auto joint_range = burst::join(burst::iterator::indexed_join, chunks);
+
+        BOOST_CHECK_EQUAL(*std::lower_bound(joint_range.begin(), joint_range.end(), 6), 7);
+        BOOST_CHECK_EQUAL(*std::lower_bound(joint_range.begin(), joint_range.end(), 13), 13);
+        BOOST_CHECK(std::lower_bound(joint_range.begin(), joint_range.end(), 14) == joint_range.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(modifying_indexed_joint_ranges_is_allowed)
+    {
+        std::vector<std::vector<int>> chunks{{5, 1}, {4}, {}, {2, 3}};
+
+        auto joint_range = burst::join(burst::iterator::indexed_join, chunks);
+        std::nth_element(joint_range.begin(), joint_range.begin() + 2, joint_range.end());
+
+        BOOST_CHECK_EQUAL(*(joint_range.begin() + 2), 3);
+        std::sort(joint_range.begin(), joint_range.end());
+        BOOST_CHECK(chunks == (std::vector<std::vector<int>>{{1, 2}, {3}, {}, {4, 5}}));
+    }
 BOOST_AUTO_TEST_SUITE_END()
@@ -4,11 +4,14 @@
 #include <burst/range/merge.hpp>
 
 #include <boost/range/algorithm/for_each.hpp>
+#include <boost/range/algorithm_ext/push_back.hpp>
 #include <boost/range/iterator_range.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include <functional>
 #include <iterator>
+#include <numeric>
+#include <string>
 #include <vector>
 
 BOOST_AUTO_TEST_SUITE(merge)
@@ -83,4 +86,182 @@ BOOST_AUTO_TEST_SUITE(merge)
         BOOST_CHECK_EQUAL(second[0], 7);
         BOOST_CHECK_EQUAL(second[1], 3);
     }
+
+    BOOST_AUTO_TEST_CASE(merging_ranges_made_of_long_runs_results_sorted_range)
+    {
+        std::vector<std::vector<int>> values(3);
+        for (int i = 0; i < 1000; ++i)
+        {
+            values[static_cast<std::size_t>((i / 50 + i / 7) % 3)].push_back(i);
+        }
+        std::vector<boost::iterator_range<std::vector<int>::iterator>> ranges;
+        for (auto & v: values)
+        {
+            ranges.push_back(boost::make_iterator_range(v));
+        }
+
+        std::vector<int> merged;
+        boost::push_back(merged, burst::merge(ranges));
+
+        std::vector<int> expected(1000);
+        std::iota(expected.begin(), expected.end(), 0);
+        BOOST_CHECK(merged == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(loser_tree_merge_of_empty_ranges_is_empty)
+    {
+        std::vector<int> first;
+        std::vector<int> second;
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto merged_range = burst::merge(burst::iterator::loser_tree_merge, ranges);
+        BOOST_CHECK(merged_range.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(loser_tree_merge_respects_custom_order)
+    {
+        auto first = burst::make_list({'h', 'f', 'd', 'b'});
+        auto second = burst::make_list({'g', 'e', 'c', 'a'});
+        auto third = burst::make_list({'i'});
+        auto ranges = burst::make_range_vector(first, second, third);
+
+        auto merged_range = burst::merge(burst::iterator::loser_tree_merge, ranges, std::greater<>{});
+
+        auto expected_collection = {'i', 'h', 'g', 'f', 'e', 'd', 'c', 'b', 'a'};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(merged_range), std::end(merged_range),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(loser_tree_merge_gives_the_same_result_as_heap_merge)
+    {
+        for (std::size_t range_count = 1; range_count < 20; ++range_count)
+        {
+            std::vector<std::vector<int>> values(range_count);
+            for (std::size_t i = 0; i < range_count; ++i)
+            {
+                for (std::size_t j = 0; j < (i * 7) % 11; ++j)
+                {
+                    values[i].push_back(static_cast<int>((j * range_count + i * 3) % 50 + j * 50));
+                }
+            }
+
+            std::vector<boost::iterator_range<std::vector<int>::const_iterator>> heap_ranges;
+            for (const auto & v: values)
+            {
+                heap_ranges.push_back(boost::make_iterator_range(v));
+            }
+            auto loser_tree_ranges = heap_ranges;
+
+            std::vector<int> expected;
+            boost::push_back(expected, burst::merge(heap_ranges));
+            std::vector<int> merged;
+            boost::push_back(merged, burst::merge(burst::iterator::loser_tree_merge, loser_tree_ranges));
+
+            BOOST_CHECK(merged == expected);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(loser_tree_merge_of_non_trivially_copyable_values_is_sorted)
+    {
+        auto first = burst::make_vector<std::string>({"aa", "c", "d"});
+        auto second = burst::make_vector<std::string>({"ab", "b"});
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto merged_range = burst::merge(burst::iterator::loser_tree_merge, ranges);
+
+        auto expected_collection = burst::make_vector<std::string>({"aa", "ab", "b", "c", "d"});
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(merged_range), std::end(merged_range),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(modifying_loser_tree_merged_mutable_ranges_is_allowed)
+    {
+        auto first = burst::make_vector({100, 50});
+        auto second = burst::make_vector({70, 30});
+
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto merged_range = burst::merge(burst::iterator::loser_tree_merge, ranges, std::greater<>{});
+        boost::for_each(merged_range, [] (auto & x) { x /= 10; });
+
+        BOOST_CHECK_EQUAL(first[0], 10);
+        BOOST_CHECK_EQUAL(first[1], 5);
+        BOOST_CHECK_EQUAL(second[0], 7);
+        BOOST_CHECK_EQUAL(second[1], 3);
+    }
+
+    BOOST_AUTO_TEST_CASE(prefetching_merge_gives_the_same_result_as_plain_merge)
+    {
+        std::vector<std::vector<int>> values(13);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            for (std::size_t j = 0; j < (i * 37) % 101; ++j)
+            {
+                values[i].push_back(static_cast<int>((j * 13 + i * 5) % 40 + j * 40));
+            }
+        }
+
+        std::vector<boost::iterator_range<std::vector<int>::const_iterator>> ranges;
+        for (const auto & v: values)
+        {
+            ranges.push_back(boost::make_iterator_range(v));
+        }
+
+        std::vector<int> expected;
+        auto plain_ranges = ranges;
+        boost::push_back(expected, burst::merge(plain_ranges));
+
+        const std::size_t distances[] = {0, 1, 8, 1000};
+        for (auto distance: distances)
+        {
+            auto heap_ranges = ranges;
+            std::vector<int> heap_merged;
+            boost::push_back(heap_merged, burst::merge(burst::iterator::prefetch_t{distance}, heap_ranges));
+            BOOST_CHECK(heap_merged == expected);
+
+            auto loser_tree_ranges = ranges;
+            std::vector<int> loser_tree_merged;
+            boost::push_back(loser_tree_merged,
+                burst::merge(burst::iterator::loser_tree_merge, burst::iterator::prefetch_t{distance}, loser_tree_ranges));
+            BOOST_CHECK(loser_tree_merged == expected);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(prefetching_merge_respects_custom_order)
+    {
+        auto first = burst::make_vector({9, 6, 3});
+        auto second = burst::make_vector({8, 5, 2});
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto merged_range = burst::merge(burst::iterator::prefetch_t{2}, ranges, std::greater<>{});
+
+        auto expected_collection = {9, 8, 6, 5, 3, 2};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(merged_range), std::end(merged_range),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(prefetching_merge_accepts_ranges_without_random_access)
+    {
+        auto first = burst::make_list({1, 4, 7});
+        auto second = burst::make_list({2, 5, 8});
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto merged_range = burst::merge(burst::iterator::loser_tree_merge, burst::iterator::prefetch_t{4}, ranges);
+
+        auto expected_collection = {1, 2, 4, 5, 7, 8};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(merged_range), std::end(merged_range),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
 BOOST_AUTO_TEST_SUITE_END()
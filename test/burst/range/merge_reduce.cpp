@@ -0,0 +1,152 @@
+#include <burst/container/make_list.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/iterator/merge_policy.hpp>
+#include <burst/range/make_range_vector.hpp>
+#include <burst/range/merge_reduce.hpp>
+
+#include <boost/range/algorithm_ext/push_back.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+#include <iterator>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(merge_reduce)
+    const auto key_of = [] (const auto & p) {return p.first;};
+    const auto add_counts = [] (auto a, const auto & b) {a.second += b.second; return a;};
+    const auto keep_first = [] (auto a, const auto &) {return a;};
+    const auto identity = [] (auto x) {return x;};
+
+    BOOST_AUTO_TEST_CASE(reducing_empty_ranges_results_empty_range)
+    {
+        std::vector<std::pair<int, int>> first;
+        std::vector<std::pair<int, int>> second;
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto reduced = burst::merge_reduce(ranges, key_of, add_counts);
+
+        BOOST_CHECK(reduced.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(counts_of_equal_keys_from_several_shards_are_summed)
+    {
+        auto first = burst::make_vector<std::pair<int, int>>({{1, 10}, {3, 30}, {5, 50}});
+        auto second = burst::make_vector<std::pair<int, int>>({{1, 1}, {2, 2}, {5, 5}});
+        auto third = burst::make_vector<std::pair<int, int>>({{5, 100}, {6, 600}});
+        auto ranges = burst::make_range_vector(first, second, third);
+
+        auto reduced = burst::merge_reduce(ranges, key_of, add_counts);
+
+        std::vector<std::pair<int, int>> actual(std::begin(reduced), std::end(reduced));
+        const auto expected = burst::make_vector<std::pair<int, int>>({{1, 11}, {2, 2}, {3, 30}, {5, 155}, {6, 600}});
+        BOOST_CHECK(actual == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(equal_keys_inside_one_range_are_reduced_too)
+    {
+        auto first = burst::make_vector<std::pair<char, int>>({{'a', 1}, {'a', 2}, {'a', 3}, {'b', 1}});
+        auto second = burst::make_vector<std::pair<char, int>>({{'b', 1}, {'b', 1}});
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto reduced = burst::merge_reduce(ranges, key_of, add_counts);
+
+        std::vector<std::pair<char, int>> actual(std::begin(reduced), std::end(reduced));
+        const auto expected = burst::make_vector<std::pair<char, int>>({{'a', 6}, {'b', 3}});
+        BOOST_CHECK(actual == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(reducer_returning_its_first_argument_makes_merge_unique)
+    {
+        auto first = burst::make_list({1, 1, 3, 5, 8});
+        auto second = burst::make_list({1, 2, 3, 8, 8, 9});
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto reduced = burst::merge_reduce(ranges, identity, keep_first);
+
+        auto expected_collection = {1, 2, 3, 5, 8, 9};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(reduced), std::end(reduced),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(elements_of_a_key_are_reduced_in_merge_order)
+    {
+        auto first = burst::make_vector<std::pair<int, std::string>>({{1, "a"}, {2, "x"}});
+        auto second = burst::make_vector<std::pair<int, std::string>>({{1, "b"}, {1, "c"}});
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto reduced = burst::merge_reduce(ranges, key_of,
+            [] (auto a, const auto & b) {a.second += b.second; return a;});
+
+        std::vector<std::pair<int, std::string>> actual(std::begin(reduced), std::end(reduced));
+        BOOST_REQUIRE_EQUAL(actual.size(), 2u);
+        BOOST_CHECK_EQUAL(actual[0].first, 1);
+        BOOST_CHECK_EQUAL(actual[0].second, "abc");
+        BOOST_CHECK_EQUAL(actual[1].second, "x");
+    }
+
+    BOOST_AUTO_TEST_CASE(keys_are_compared_with_custom_order)
+    {
+        auto first = burst::make_vector<std::pair<int, int>>({{9, 1}, {4, 1}, {1, 1}});
+        auto second = burst::make_vector<std::pair<int, int>>({{9, 2}, {7, 2}, {1, 2}});
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto reduced = burst::merge_reduce(ranges, key_of, add_counts, std::greater<>{});
+
+        std::vector<std::pair<int, int>> actual(std::begin(reduced), std::end(reduced));
+        const auto expected = burst::make_vector<std::pair<int, int>>({{9, 3}, {7, 2}, {4, 1}, {1, 3}});
+        BOOST_CHECK(actual == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(loser_tree_reduction_gives_the_same_result_as_heap_reduction)
+    {
+        std::vector<std::vector<std::pair<int, int>>> shards(11);
+        std::map<int, int> expected_counts;
+        for (std::size_t shard = 0; shard < shards.size(); ++shard)
+        {
+            for (int key = 0; key < 200; key += static_cast<int>(shard % 4) + 1)
+            {
+                const auto count = key % 7 + static_cast<int>(shard);
+                shards[shard].emplace_back(key, count);
+                expected_counts[key] += count;
+            }
+        }
+        const std::vector<std::pair<int, int>> expected(expected_counts.begin(), expected_counts.end());
+
+        std::vector<boost::iterator_range<std::vector<std::pair<int, int>>::const_iterator>> heap_ranges;
+        for (const auto & shard: shards)
+        {
+            heap_ranges.push_back(boost::make_iterator_range(shard));
+        }
+        auto loser_tree_ranges = heap_ranges;
+
+        std::vector<std::pair<int, int>> heap_reduced;
+        boost::push_back(heap_reduced, burst::merge_reduce(heap_ranges, key_of, add_counts));
+        BOOST_CHECK(heap_reduced == expected);
+
+        std::vector<std::pair<int, int>> loser_tree_reduced;
+        boost::push_back(loser_tree_reduced,
+            burst::merge_reduce(burst::iterator::loser_tree_merge, loser_tree_ranges, key_of, add_counts));
+        BOOST_CHECK(loser_tree_reduced == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(loser_tree_reduction_accepts_custom_order)
+    {
+        auto first = burst::make_vector<std::pair<int, int>>({{5, 1}, {5, 1}, {3, 1}});
+        auto second = burst::make_vector<std::pair<int, int>>({{6, 1}, {5, 1}, {3, 1}, {3, 1}});
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto reduced =
+            burst::merge_reduce(burst::iterator::loser_tree_merge, ranges, key_of, add_counts, std::greater<>{});
+
+        std::vector<std::pair<int, int>> actual(std::begin(reduced), std::end(reduced));
+        const auto expected = burst::make_vector<std::pair<int, int>>({{6, 1}, {5, 3}, {3, 3}});
+        BOOST_CHECK(actual == expected);
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -260,4 +260,42 @@ BOOST_AUTO_TEST_SUITE(semiintersect)
             std::begin(expected_collection), std::end(expected_collection)
         );
     }
+
+    BOOST_AUTO_TEST_CASE(ranges_overtaking_the_candidate_do_not_hide_semiintersections)
+    {
+        auto  first = {1,              5,          9,      13};
+        auto second = {    2,              6,          10, 13};
+        auto  third = {        3,      5,      7,      10    };
+        auto fourth = {            4,      6,  7,          13};
+        auto  fifth = {1,  2,                      9         };
+        //             ^   ^           ^   ^   ^   ^   ^   ^
+
+        auto ranges = burst::make_range_vector(first, second, third, fourth, fifth);
+        auto semiintersection = burst::semiintersect(ranges, 2);
+
+        auto expected_collection = {1, 2, 5, 6, 7, 9, 10, 13};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(semiintersection), std::end(semiintersection),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(semiintersection_of_ranges_of_non_trivially_copyable_elements_is_correct)
+    {
+        const std::vector<std::string>  first{"a", "bb", "ccc",        "eeeee"};
+        const std::vector<std::string> second{"a",       "ccc", "dddd", "eeeee"};
+        const std::vector<std::string>  third{     "bb",        "dddd"         };
+        //                                     ^    ^     ^      ^       ^
+
+        auto ranges = burst::make_range_vector(first, second, third);
+        auto semiintersection = burst::semiintersect(ranges, 2);
+
+        const auto expected_collection = {"a", "bb", "ccc", "dddd", "eeeee"};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(semiintersection), std::end(semiintersection),
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
 BOOST_AUTO_TEST_SUITE_END()
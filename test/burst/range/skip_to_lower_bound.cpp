@@ -1,9 +1,13 @@
 #include <burst/container/make_vector.hpp>
+#include <burst/range/skip_policy.hpp>
 #include <burst/range/skip_to_lower_bound.hpp>
 
 #include <boost/range/iterator_range.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <forward_list>
 #include <functional>
 #include <vector>
 
@@ -70,4 +74,47 @@ BOOST_AUTO_TEST_SUITE(skip_to_lower_bound)
             boost::begin(values) + 2, boost::end(values)
         );
     }
+
+    BOOST_AUTO_TEST_CASE(galloping_skip_stops_at_lower_bound_for_any_goal_and_any_jump_limit)
+    {
+        auto values = burst::make_vector({1, 1, 2, 3, 3, 3, 5, 8, 13, 21, 34, 34, 55, 89, 144});
+
+        for (auto max_jumps: {std::size_t{0}, std::size_t{1}, std::size_t{2}, std::size_t{5}})
+        {
+            for (auto goal = 0; goal <= 150; ++goal)
+            {
+                auto range = boost::make_iterator_range(values);
+
+                burst::skip_to_lower_bound(range, goal, std::less<>{}, burst::galloping_skip_t{max_jumps});
+
+                const auto expected = std::lower_bound(values.begin(), values.end(), goal);
+                BOOST_CHECK(range.begin() == expected);
+                BOOST_CHECK(range.end() == values.end());
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(binary_skip_stops_at_lower_bound)
+    {
+        auto values = burst::make_vector({10, 8, 8, 6, 4, 2});
+        auto range = boost::make_iterator_range(values);
+
+        burst::skip_to_lower_bound(range, 7, std::greater<>{}, burst::binary_skip);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            boost::begin(range), boost::end(range),
+            boost::begin(values) + 3, boost::end(values)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(skip_policy_does_not_matter_for_forward_range)
+    {
+        std::forward_list<int> values{1, 2, 3, 4, 5};
+        auto range = boost::make_iterator_range(values);
+
+        burst::skip_to_lower_bound(range, 4, std::less<>{}, burst::binary_skip);
+
+        BOOST_CHECK_EQUAL(range.front(), 4);
+    }
 BOOST_AUTO_TEST_SUITE_END()